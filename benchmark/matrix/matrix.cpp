@@ -1,10 +1,18 @@
+#include <utility>
+#include <vector>
+
 #include <benchmark/benchmark.h>
 
 #include "caramel-math/matrix/AssertErrorHandler.hpp"
 #include "caramel-math/matrix/ThrowingErrorHandler.hpp"
 #include "caramel-math/matrix/AffineTransformStorage.hpp"
 #include "caramel-math/matrix/ArrayStorage.hpp"
+#include "caramel-math/matrix/LUDecomposition.hpp"
+#include "caramel-math/matrix/MatrixExpression.hpp"
+#include "caramel-math/matrix/SimdAffineTransformStorage.hpp"
 #include "caramel-math/matrix/SimdStorage.hpp"
+#include "caramel-math/matrix/multiply-chain.hpp"
+#include "caramel-math/matrix/simd-dispatch.hpp"
 #include "caramel-math/matrix/Matrix.hpp"
 #include "caramel-math/scalar/ScalarTraits.hpp"
 
@@ -18,12 +26,26 @@ using ArrayNoexcept = ArrayStorage<scalar::BasicScalarTraits<float>, 4, 4, Asser
 using ArrayThrowing = ArrayStorage<scalar::BasicScalarTraits<float>, 4, 4, ThrowingErrorHandler>;
 using SimdNoexcept = SimdStorage<scalar::BasicScalarTraits<float>, AssertErrorHandler>;
 using SimdThrowing = SimdStorage<scalar::BasicScalarTraits<float>, ThrowingErrorHandler>;
+using AffineNoexcept = AffineTransformStorage<scalar::BasicScalarTraits<float>, AssertErrorHandler>;
+using SimdAffineNoexcept = SimdAffineTransformStorage<scalar::BasicScalarTraits<float>, AssertErrorHandler>;
+using ArrayDouble = ArrayStorage<scalar::BasicScalarTraits<double>, 4, 4, AssertErrorHandler>;
+using SimdDouble = SimdStorage<scalar::BasicScalarTraits<double>, AssertErrorHandler>;
+using Array3x3Noexcept = ArrayStorage<scalar::BasicScalarTraits<float>, 3, 3, AssertErrorHandler>;
+using Array3x3Double = ArrayStorage<scalar::BasicScalarTraits<double>, 3, 3, AssertErrorHandler>;
+using Array3x4Noexcept = ArrayStorage<scalar::BasicScalarTraits<float>, 3, 4, AssertErrorHandler>;
+using Array6x6Double = ArrayStorage<scalar::BasicScalarTraits<double>, 6, 6, AssertErrorHandler>;
+using Array8x8Double = ArrayStorage<scalar::BasicScalarTraits<double>, 8, 8, AssertErrorHandler>;
+using Array8x8Integer = ArrayStorage<scalar::BasicScalarTraits<long long>, 8, 8, AssertErrorHandler>;
+using Array12x12Integer = ArrayStorage<scalar::BasicScalarTraits<long long>, 12, 12, AssertErrorHandler>;
 
 template <class StorageType>
 void benchmarkMatrixMultiplication(benchmark::State& state) {
 	auto lhs = Matrix<StorageType>();
 	auto rhs = Matrix<StorageType>();
 	for (auto _ : state) {
+		// Keeps the operands opaque, so that the product can't be hoisted out of the loop.
+		benchmark::DoNotOptimize(lhs);
+		benchmark::DoNotOptimize(rhs);
 		benchmark::DoNotOptimize(lhs * rhs);
 	}
 }
@@ -32,6 +54,474 @@ BENCHMARK_TEMPLATE(benchmarkMatrixMultiplication, ArrayNoexcept);
 BENCHMARK_TEMPLATE(benchmarkMatrixMultiplication, ArrayThrowing);
 BENCHMARK_TEMPLATE(benchmarkMatrixMultiplication, SimdNoexcept);
 BENCHMARK_TEMPLATE(benchmarkMatrixMultiplication, SimdThrowing);
+BENCHMARK_TEMPLATE(benchmarkMatrixMultiplication, ArrayDouble);
+BENCHMARK_TEMPLATE(benchmarkMatrixMultiplication, SimdDouble);
+BENCHMARK_TEMPLATE(benchmarkMatrixMultiplication, AffineNoexcept);
+BENCHMARK_TEMPLATE(benchmarkMatrixMultiplication, SimdAffineNoexcept);
+BENCHMARK_TEMPLATE(benchmarkMatrixMultiplication, Array3x3Noexcept);
+BENCHMARK_TEMPLATE(benchmarkMatrixMultiplication, Array3x3Double);
+
+template <class LHSStorageType, class RHSStorageType>
+void benchmarkRectangularMatrixMultiplication(benchmark::State& state) {
+	auto lhs = Matrix<LHSStorageType>();
+	auto rhs = Matrix<RHSStorageType>();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(lhs);
+		benchmark::DoNotOptimize(rhs);
+		benchmark::DoNotOptimize(lhs * rhs);
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkRectangularMatrixMultiplication, Array3x4Noexcept, ArrayNoexcept);
+
+// Affine transform times a full 4x4 matrix, e.g. a model transform applied to a projection-view matrix.
+template <class AffineStorageType, class FullStorageType>
+void benchmarkAffineByFullMatrixMultiplication(benchmark::State& state) {
+	auto lhs = Matrix<AffineStorageType>();
+	auto rhs = Matrix<FullStorageType>();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(lhs);
+		benchmark::DoNotOptimize(rhs);
+		benchmark::DoNotOptimize(lhs * rhs);
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkAffineByFullMatrixMultiplication, AffineNoexcept, ArrayNoexcept);
+BENCHMARK_TEMPLATE(benchmarkAffineByFullMatrixMultiplication, SimdNoexcept, SimdNoexcept);
+BENCHMARK_TEMPLATE(benchmarkAffineByFullMatrixMultiplication, SimdAffineNoexcept, SimdNoexcept);
+
+template <class StorageType>
+void benchmarkMatrixTransposition(benchmark::State& state) {
+	auto matrix = Matrix<StorageType>();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(matrix);
+		benchmark::DoNotOptimize(transposed(matrix));
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkMatrixTransposition, ArrayNoexcept);
+BENCHMARK_TEMPLATE(benchmarkMatrixTransposition, SimdNoexcept);
+BENCHMARK_TEMPLATE(benchmarkMatrixTransposition, ArrayDouble);
+BENCHMARK_TEMPLATE(benchmarkMatrixTransposition, SimdDouble);
+BENCHMARK_TEMPLATE(benchmarkMatrixTransposition, Array8x8Double);
+
+template <class StorageType>
+void benchmarkMatrixInPlaceTransposition(benchmark::State& state) {
+	auto matrix = Matrix<StorageType>();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(matrix.transpose());
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkMatrixInPlaceTransposition, ArrayNoexcept);
+BENCHMARK_TEMPLATE(benchmarkMatrixInPlaceTransposition, SimdNoexcept);
+
+// Product with a transposed operand, e.g. when transforming normals by (M^-1)^T.
+template <class StorageType>
+void benchmarkMatrixTransposedMultiplication(benchmark::State& state) {
+	auto lhs = Matrix<StorageType>();
+	auto rhs = Matrix<StorageType>();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(lhs);
+		benchmark::DoNotOptimize(rhs);
+		benchmark::DoNotOptimize(lhs * transposed(rhs));
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkMatrixTransposedMultiplication, ArrayNoexcept);
+BENCHMARK_TEMPLATE(benchmarkMatrixTransposedMultiplication, SimdNoexcept);
+BENCHMARK_TEMPLATE(benchmarkMatrixTransposedMultiplication, Array8x8Double);
+
+// A^T * B through a transposed view, without copying A.
+template <class StorageType>
+void benchmarkTransposedViewMultiplication(benchmark::State& state) {
+	auto lhs = Matrix<StorageType>();
+	auto rhs = Matrix<StorageType>();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(lhs);
+		benchmark::DoNotOptimize(rhs);
+		benchmark::DoNotOptimize(viewTransposed(lhs) * rhs);
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkTransposedViewMultiplication, ArrayNoexcept);
+BENCHMARK_TEMPLATE(benchmarkTransposedViewMultiplication, SimdNoexcept);
+BENCHMARK_TEMPLATE(benchmarkTransposedViewMultiplication, Array8x8Double);
+
+// Generic closed forms on ArrayStorage and SimdStorage against the blockwise SimdStorage overloads.
+struct GenericInversion {
+	template <class StorageType>
+	static auto determinant(const Matrix<StorageType>& matrix) noexcept {
+		return matrix::determinant<StorageType>(matrix);
+	}
+
+	template <class StorageType>
+	static auto inverse(const Matrix<StorageType>& matrix) noexcept {
+		return matrix::inverse<StorageType>(matrix);
+	}
+};
+
+struct OverloadedInversion {
+	template <class StorageType>
+	static auto determinant(const Matrix<StorageType>& matrix) noexcept {
+		return matrix::determinant(matrix);
+	}
+
+	template <class StorageType>
+	static auto inverse(const Matrix<StorageType>& matrix) noexcept {
+		return matrix::inverse(matrix);
+	}
+};
+
+template <class StorageType>
+Matrix<StorageType> invertibleMatrix() {
+	if constexpr (StorageType::ROWS == 3) {
+		return Matrix<StorageType>(
+			2.0f, 1.0f, 0.0f,
+			1.0f, 5.0f, 2.0f,
+			0.0f, 4.0f, 7.0f
+			);
+	} else {
+		const auto affineTransform = Matrix<ArrayNoexcept>(
+			2.0f, 1.0f, 0.0f, 3.0f,
+			1.0f, 5.0f, 2.0f, 0.0f,
+			0.0f, 4.0f, 7.0f, 1.0f,
+			0.0f, 0.0f, 0.0f, 1.0f
+			);
+		return Matrix<StorageType>(affineTransform);
+	}
+}
+
+template <class LHSStorageType, class RHSStorageType>
+void benchmarkMixedStorageMultiplication(benchmark::State& state) {
+	auto lhs = invertibleMatrix<LHSStorageType>();
+	auto rhs = invertibleMatrix<RHSStorageType>();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(lhs);
+		benchmark::DoNotOptimize(rhs);
+		benchmark::DoNotOptimize(lhs * rhs);
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkMixedStorageMultiplication, ArrayNoexcept, SimdNoexcept);
+BENCHMARK_TEMPLATE(benchmarkMixedStorageMultiplication, SimdNoexcept, ArrayNoexcept);
+BENCHMARK_TEMPLATE(benchmarkMixedStorageMultiplication, AffineNoexcept, SimdNoexcept);
+BENCHMARK_TEMPLATE(benchmarkMixedStorageMultiplication, ArrayDouble, SimdDouble);
+
+// Chained products, scaled and with a transposed operand, evaluated eagerly or through lazy expressions.
+struct EagerEvaluation {
+	template <class StorageType>
+	static Matrix<StorageType> scaledChain(
+		const Matrix<StorageType>& projection,
+		const Matrix<StorageType>& view,
+		const Matrix<StorageType>& model
+		)
+	{
+		return projection * view * model * 0.5f;
+	}
+
+	template <class StorageType>
+	static Matrix<StorageType> transposedProduct(const Matrix<StorageType>& lhs, const Matrix<StorageType>& rhs) {
+		return Matrix<StorageType>(lhs * transposed(rhs));
+	}
+};
+
+struct LazyEvaluation {
+	template <class StorageType>
+	static Matrix<StorageType> scaledChain(
+		const Matrix<StorageType>& projection,
+		const Matrix<StorageType>& view,
+		const Matrix<StorageType>& model
+		)
+	{
+		return lazy(projection) * view * model * 0.5f;
+	}
+
+	template <class StorageType>
+	static Matrix<StorageType> transposedProduct(const Matrix<StorageType>& lhs, const Matrix<StorageType>& rhs) {
+		return lazy(lhs) * transposed(lazy(rhs));
+	}
+};
+
+template <class StorageType, class EvaluationPolicy>
+void benchmarkScaledMatrixChain(benchmark::State& state) {
+	const auto projection = invertibleMatrix<StorageType>();
+	const auto view = invertibleMatrix<StorageType>();
+	const auto model = invertibleMatrix<StorageType>();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(EvaluationPolicy::scaledChain(projection, view, model));
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkScaledMatrixChain, ArrayNoexcept, EagerEvaluation);
+BENCHMARK_TEMPLATE(benchmarkScaledMatrixChain, ArrayNoexcept, LazyEvaluation);
+BENCHMARK_TEMPLATE(benchmarkScaledMatrixChain, SimdNoexcept, EagerEvaluation);
+BENCHMARK_TEMPLATE(benchmarkScaledMatrixChain, SimdNoexcept, LazyEvaluation);
+
+template <class StorageType, class EvaluationPolicy>
+void benchmarkLazyTransposedMultiplication(benchmark::State& state) {
+	const auto lhs = invertibleMatrix<StorageType>();
+	const auto rhs = invertibleMatrix<StorageType>();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(EvaluationPolicy::transposedProduct(lhs, rhs));
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkLazyTransposedMultiplication, ArrayNoexcept, EagerEvaluation);
+BENCHMARK_TEMPLATE(benchmarkLazyTransposedMultiplication, ArrayNoexcept, LazyEvaluation);
+BENCHMARK_TEMPLATE(benchmarkLazyTransposedMultiplication, SimdNoexcept, EagerEvaluation);
+BENCHMARK_TEMPLATE(benchmarkLazyTransposedMultiplication, SimdNoexcept, LazyEvaluation);
+
+// Diagonally dominant, so invertible at any size.
+template <class StorageType>
+Matrix<StorageType> invertibleLargeMatrix() {
+	auto matrix = Matrix<StorageType>();
+	for (auto rowIdx = Row(0); rowIdx.value() < StorageType::ROWS; ++rowIdx) {
+		for (auto columnIdx = Column(0); columnIdx.value() < StorageType::COLUMNS; ++columnIdx) {
+			using Scalar = typename StorageType::Scalar;
+			const auto offDiagonal = Scalar((rowIdx.value() * 3 + columnIdx.value() * 7) % 5);
+			matrix.set(rowIdx, columnIdx, rowIdx.value() == columnIdx.value() ? Scalar(20) : offDiagonal);
+		}
+	}
+	return matrix;
+}
+
+template <class StorageType>
+void benchmarkLargeMatrixDeterminant(benchmark::State& state) {
+	const auto matrix = invertibleLargeMatrix<StorageType>();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(determinant(matrix));
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkLargeMatrixDeterminant, Array6x6Double);
+BENCHMARK_TEMPLATE(benchmarkLargeMatrixDeterminant, Array8x8Double);
+BENCHMARK_TEMPLATE(benchmarkLargeMatrixDeterminant, Array8x8Integer);
+BENCHMARK_TEMPLATE(benchmarkLargeMatrixDeterminant, Array12x12Integer);
+
+template <class StorageType>
+void benchmarkLargeMatrixInverse(benchmark::State& state) {
+	const auto matrix = invertibleLargeMatrix<StorageType>();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(inverse(matrix));
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkLargeMatrixInverse, Array6x6Double);
+BENCHMARK_TEMPLATE(benchmarkLargeMatrixInverse, Array8x8Double);
+
+// A single decomposition reused for every right-hand side.
+template <class StorageType>
+void benchmarkLargeMatrixSolve(benchmark::State& state) {
+	using VectorStorage = ArrayStorage<typename StorageType::ScalarTraits, StorageType::ROWS, 1, AssertErrorHandler>;
+	const auto decomposition = LUDecomposition(invertibleLargeMatrix<StorageType>());
+	auto rhs = Matrix<VectorStorage>();
+	for (auto rowIdx = Row(0); rowIdx.value() < StorageType::ROWS; ++rowIdx) {
+		rhs.set(rowIdx, Column(0), double(rowIdx.value()));
+	}
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(decomposition.solve(rhs));
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkLargeMatrixSolve, Array6x6Double);
+BENCHMARK_TEMPLATE(benchmarkLargeMatrixSolve, Array8x8Double);
+
+template <class StorageType, class InversionPolicy>
+void benchmarkMatrixDeterminant(benchmark::State& state) {
+	const auto matrix = invertibleMatrix<StorageType>();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(InversionPolicy::determinant(matrix));
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkMatrixDeterminant, Array3x3Noexcept, GenericInversion);
+BENCHMARK_TEMPLATE(benchmarkMatrixDeterminant, ArrayNoexcept, GenericInversion);
+BENCHMARK_TEMPLATE(benchmarkMatrixDeterminant, ArrayDouble, GenericInversion);
+BENCHMARK_TEMPLATE(benchmarkMatrixDeterminant, SimdNoexcept, GenericInversion);
+BENCHMARK_TEMPLATE(benchmarkMatrixDeterminant, SimdNoexcept, OverloadedInversion);
+
+template <class StorageType, class InversionPolicy>
+void benchmarkMatrixInverse(benchmark::State& state) {
+	const auto matrix = invertibleMatrix<StorageType>();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(InversionPolicy::inverse(matrix));
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkMatrixInverse, Array3x3Noexcept, GenericInversion);
+BENCHMARK_TEMPLATE(benchmarkMatrixInverse, ArrayNoexcept, GenericInversion);
+BENCHMARK_TEMPLATE(benchmarkMatrixInverse, ArrayDouble, GenericInversion);
+BENCHMARK_TEMPLATE(benchmarkMatrixInverse, SimdNoexcept, GenericInversion);
+BENCHMARK_TEMPLATE(benchmarkMatrixInverse, SimdNoexcept, OverloadedInversion);
+BENCHMARK_TEMPLATE(benchmarkMatrixInverse, AffineNoexcept, OverloadedInversion);
+
+// Inverse of a view-like transform, rotation and translation only.
+template <class StorageType>
+void benchmarkMatrixRigidInverse(benchmark::State& state) {
+	const auto matrix = Matrix<StorageType>(
+		0.0f, -1.0f, 0.0f, 1.0f,
+		0.0f, 0.0f, -1.0f, 2.0f,
+		1.0f, 0.0f, 0.0f, 3.0f
+		);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(inverseRigid(matrix));
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkMatrixRigidInverse, AffineNoexcept);
+
+// A (3x8) * B (8x8) * C (8x1), left to right or in the order chosen by multiplyChain().
+struct LeftToRightChain {
+	template <class AType, class BType, class CType>
+	static auto multiply(const AType& a, const BType& b, const CType& c) {
+		return a * b * c;
+	}
+};
+
+struct OptimalChain {
+	template <class AType, class BType, class CType>
+	static auto multiply(const AType& a, const BType& b, const CType& c) {
+		return multiplyChain(a, b, c);
+	}
+};
+
+template <class ChainPolicy>
+void benchmarkMatrixChainMultiplication(benchmark::State& state) {
+	using Traits = scalar::BasicScalarTraits<double>;
+	const auto a = Matrix<ArrayStorage<Traits, 3, 8, AssertErrorHandler>>::ZERO;
+	const auto b = invertibleLargeMatrix<Array8x8Double>();
+	const auto c = Matrix<ArrayStorage<Traits, 8, 1, AssertErrorHandler>>::ZERO;
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(ChainPolicy::multiply(a, b, c));
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkMatrixChainMultiplication, LeftToRightChain);
+BENCHMARK_TEMPLATE(benchmarkMatrixChainMultiplication, OptimalChain);
+
+// Two independent products, either computed one after the other with Float4 or together with Float8.
+struct SeparateProducts {
+	template <class StorageType>
+	static auto multiply(
+		const Matrix<StorageType>& lhs0,
+		const Matrix<StorageType>& rhs0,
+		const Matrix<StorageType>& lhs1,
+		const Matrix<StorageType>& rhs1
+		)
+	{
+		return std::make_pair(lhs0 * rhs0, lhs1 * rhs1);
+	}
+};
+
+struct PairedProducts {
+	template <class StorageType>
+	static auto multiply(
+		const Matrix<StorageType>& lhs0,
+		const Matrix<StorageType>& rhs0,
+		const Matrix<StorageType>& lhs1,
+		const Matrix<StorageType>& rhs1
+		)
+	{
+		return multiplyPairs(lhs0, rhs0, lhs1, rhs1);
+	}
+};
+
+template <class MultiplicationPolicy>
+void benchmarkMatrixPairMultiplication(benchmark::State& state) {
+	auto lhs0 = Matrix<SimdNoexcept>();
+	auto rhs0 = Matrix<SimdNoexcept>();
+	auto lhs1 = Matrix<SimdNoexcept>();
+	auto rhs1 = Matrix<SimdNoexcept>();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(MultiplicationPolicy::multiply(lhs0, rhs0, lhs1, rhs1));
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkMatrixPairMultiplication, SeparateProducts);
+BENCHMARK_TEMPLATE(benchmarkMatrixPairMultiplication, PairedProducts);
+
+// Batch of 1024 products through the kernels bound for the instruction set tier given by state.range(0).
+void benchmarkDispatchedMatrixBatchMultiplication(benchmark::State& state) {
+	const auto instructionSet = static_cast<simd::InstructionSet>(state.range(0));
+	if (instructionSet > simd::detectInstructionSet()) {
+		state.SkipWithError("instruction set not supported on this host");
+		return;
+	}
+
+	const auto kernels = dispatch::simdKernels<Matrix<SimdNoexcept>>(instructionSet);
+	const auto count = size_t(1024);
+	const auto lhs = std::vector<Matrix<SimdNoexcept>>(count, Matrix<SimdNoexcept>::IDENTITY);
+	const auto rhs = std::vector<Matrix<SimdNoexcept>>(count, Matrix<SimdNoexcept>::IDENTITY);
+	auto result = std::vector<Matrix<SimdNoexcept>>(count);
+
+	for (auto _ : state) {
+		kernels.multiplyBatch(lhs.data(), rhs.data(), result.data(), count);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetLabel(simd::instructionSetName(instructionSet));
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+BENCHMARK(benchmarkDispatchedMatrixBatchMultiplication)->DenseRange(
+	static_cast<int>(simd::InstructionSet::SSE2),
+	static_cast<int>(simd::InstructionSet::AVX512)
+	);
+
+template <class StorageType>
+void benchmarkMatrixEquality(benchmark::State& state) {
+	auto lhs = Matrix<StorageType>::IDENTITY;
+	auto rhs = Matrix<StorageType>::IDENTITY;
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(lhs == rhs);
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkMatrixEquality, ArrayNoexcept);
+BENCHMARK_TEMPLATE(benchmarkMatrixEquality, ArrayThrowing);
+BENCHMARK_TEMPLATE(benchmarkMatrixEquality, SimdNoexcept);
+BENCHMARK_TEMPLATE(benchmarkMatrixEquality, SimdThrowing);
+
+// Blend of two transforms, as in animation blending.
+template <class StorageType>
+void benchmarkMatrixBlend(benchmark::State& state) {
+	const auto lhs = invertibleMatrix<StorageType>();
+	const auto rhs = Matrix<StorageType>::IDENTITY;
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(lhs * 0.25f + rhs * 0.75f);
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkMatrixBlend, ArrayNoexcept);
+BENCHMARK_TEMPLATE(benchmarkMatrixBlend, SimdNoexcept);
+
+template <class StorageType>
+void benchmarkMatrixScalarDivision(benchmark::State& state) {
+	auto matrix = invertibleMatrix<StorageType>();
+	for (auto _ : state) {
+		matrix /= 1.0001f;
+		benchmark::DoNotOptimize(matrix);
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkMatrixScalarDivision, ArrayNoexcept);
+BENCHMARK_TEMPLATE(benchmarkMatrixScalarDivision, ArrayThrowing);
+BENCHMARK_TEMPLATE(benchmarkMatrixScalarDivision, SimdNoexcept);
+
+template <class SourceStorageType, class TargetStorageType>
+void benchmarkMatrixConversion(benchmark::State& state) {
+	const auto source = invertibleMatrix<SourceStorageType>();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(Matrix<TargetStorageType>(source));
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkMatrixConversion, ArrayNoexcept, ArrayThrowing);
+BENCHMARK_TEMPLATE(benchmarkMatrixConversion, ArrayNoexcept, SimdNoexcept);
+BENCHMARK_TEMPLATE(benchmarkMatrixConversion, SimdNoexcept, ArrayNoexcept);
+BENCHMARK_TEMPLATE(benchmarkMatrixConversion, ArrayNoexcept, ArrayDouble);
+BENCHMARK_TEMPLATE(benchmarkMatrixConversion, AffineNoexcept, SimdNoexcept);
 
 template <class StorageType>
 void benchmarkMatrixGet(benchmark::State& state) {
@@ -71,6 +561,35 @@ BENCHMARK_TEMPLATE(benchmarkMatrixSetGet, ArrayThrowing);
 BENCHMARK_TEMPLATE(benchmarkMatrixSetGet, SimdNoexcept);
 BENCHMARK_TEMPLATE(benchmarkMatrixSetGet, SimdThrowing);
 
+// Element-wise writes of a whole matrix, as done by zeroMatrix, identityMatrix and the converting constructor.
+template <class StorageType>
+void benchmarkMatrixFill(benchmark::State& state) {
+	auto m = Matrix<StorageType>();
+	auto value = 0.5f;
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(value);
+		for (auto row = 0_row; row.value() < 4; ++row) {
+			for (auto column = 0_col; column.value() < 4; ++column) {
+				m.set(row, column, value);
+			}
+		}
+		benchmark::DoNotOptimize(m);
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkMatrixFill, ArrayNoexcept);
+BENCHMARK_TEMPLATE(benchmarkMatrixFill, SimdNoexcept);
+
+template <class StorageType>
+void benchmarkMatrixIdentityConstruction(benchmark::State& state) {
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(matrix::detail::identityMatrix<StorageType>());
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkMatrixIdentityConstruction, ArrayNoexcept);
+BENCHMARK_TEMPLATE(benchmarkMatrixIdentityConstruction, SimdNoexcept);
+
 template <class StorageType>
 void benchmarkMatrixSetGetColumn(benchmark::State& state) {
 	auto m = Matrix<StorageType>();
@@ -84,4 +603,54 @@ void benchmarkMatrixSetGetColumn(benchmark::State& state) {
 BENCHMARK_TEMPLATE(benchmarkMatrixSetGetColumn, SimdNoexcept);
 BENCHMARK_TEMPLATE(benchmarkMatrixSetGetColumn, SimdThrowing);
 
+// Writes state.range(0) matrices to an upload-style buffer, either through the cache or with non-temporal
+// stores. Buffers larger than the last level cache are where streaming pays off.
+struct alignas(simd::Float4::ALIGNMENT) UploadMatrix {
+	float values[16];
+};
+
+struct CachedStore {
+	template <class StorageType>
+	static void store(const Matrix<StorageType>& matrix, float* destination) noexcept {
+		matrix.get(0_col).storeAligned(destination);
+		matrix.get(1_col).storeAligned(destination + 4);
+		matrix.get(2_col).storeAligned(destination + 8);
+		matrix.get(3_col).storeAligned(destination + 12);
+	}
+
+	static void fence() noexcept {
+	}
+};
+
+struct StreamingStore {
+	template <class StorageType>
+	static void store(const Matrix<StorageType>& matrix, float* destination) noexcept {
+		streamStore(matrix, destination);
+	}
+
+	static void fence() noexcept {
+		simd::streamFence();
+	}
+};
+
+template <class StorePolicy>
+void benchmarkMatrixBulkStore(benchmark::State& state) {
+	const auto count = static_cast<size_t>(state.range(0));
+	const auto m = Matrix<SimdNoexcept>::IDENTITY;
+	auto buffer = std::vector<UploadMatrix>(count);
+
+	for (auto _ : state) {
+		for (auto& destination : buffer) {
+			StorePolicy::store(m, destination.values);
+		}
+		StorePolicy::fence();
+		benchmark::ClobberMemory();
+	}
+
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * count * sizeof(UploadMatrix)));
+}
+
+BENCHMARK_TEMPLATE(benchmarkMatrixBulkStore, CachedStore)->Arg(1 << 10)->Arg(1 << 18);
+BENCHMARK_TEMPLATE(benchmarkMatrixBulkStore, StreamingStore)->Arg(1 << 10)->Arg(1 << 18);
+
 } // anonymous namespace
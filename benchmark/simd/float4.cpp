@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "caramel-math/matrix/SimdStorage.hpp"
+#include "caramel-math/simd/Float4.hpp"
+#include "caramel-math/scalar/ulp-distance.hpp"
+
+using namespace caramel_math;
+using namespace caramel_math::simd;
+
+namespace /* anonymous */ {
+
+// Every benchmark runs against the native and the reference Float4 implementation, so the two
+// timings can be compared directly. Native runs also report the largest distance, in ulps, from the
+// reference result over a fixed set of inputs in the "maxUlps" counter.
+
+std::vector<std::array<float, 4>> validationInputs() {
+	auto generator = std::mt19937(42);
+	auto distribution = std::uniform_real_distribution<float>(-1000.0f, 1000.0f);
+
+	auto inputs = std::vector<std::array<float, 4>>(256);
+	for (auto& xyzw : inputs) {
+		std::generate(xyzw.begin(), xyzw.end(), [&]() { return distribution(generator); });
+	}
+
+	return inputs;
+}
+
+template <class Operation>
+double maxUlpsFromReference(Operation operation) {
+	const auto inputs = validationInputs();
+	auto result = std::uint32_t(0);
+
+	for (auto i = 0u; i + 1 < inputs.size(); i += 2) {
+		const auto native = operation(Float4(inputs[i]), Float4(inputs[i + 1])).xyzw();
+		const auto reference = operation(ReferenceFloat4(inputs[i]), ReferenceFloat4(inputs[i + 1])).xyzw();
+
+		for (auto lane = 0u; lane < 4u; ++lane) {
+			result = std::max(result, scalar::ulpDistance(native[lane], reference[lane]));
+		}
+	}
+
+	return static_cast<double>(result);
+}
+
+struct Add {
+	template <class Float4Type>
+	Float4Type operator()(const Float4Type& lhs, const Float4Type& rhs) const noexcept {
+		return lhs + rhs;
+	}
+};
+
+struct Subtract {
+	template <class Float4Type>
+	Float4Type operator()(const Float4Type& lhs, const Float4Type& rhs) const noexcept {
+		return lhs - rhs;
+	}
+};
+
+struct Multiply {
+	template <class Float4Type>
+	Float4Type operator()(const Float4Type& lhs, const Float4Type& rhs) const noexcept {
+		return lhs * rhs;
+	}
+};
+
+struct Divide {
+	template <class Float4Type>
+	Float4Type operator()(const Float4Type& lhs, const Float4Type& rhs) const noexcept {
+		return lhs / rhs;
+	}
+};
+
+struct Madd {
+	template <class Float4Type>
+	Float4Type operator()(const Float4Type& lhs, const Float4Type& rhs) const noexcept {
+		return madd(lhs, rhs, rhs);
+	}
+};
+
+struct Dot {
+	template <class Float4Type>
+	Float4Type operator()(const Float4Type& lhs, const Float4Type& rhs) const noexcept {
+		return dot(lhs, rhs);
+	}
+};
+
+struct Normalise {
+	template <class Float4Type>
+	Float4Type operator()(const Float4Type& lhs, const Float4Type&) const noexcept {
+		return lhs * rsqrt(dot(lhs, lhs));
+	}
+};
+
+struct NormaliseFast {
+	template <class Float4Type>
+	Float4Type operator()(const Float4Type& lhs, const Float4Type&) const noexcept {
+		return lhs * rsqrtFast<1>(dot(lhs, lhs));
+	}
+};
+
+struct CombineColumns {
+	template <class Float4Type>
+	Float4Type operator()(const Float4Type& lhs, const Float4Type& rhs) const noexcept {
+		return matrix::detail::combineColumns(lhs, rhs, lhs, rhs, rhs);
+	}
+};
+
+template <class Operation, class Float4Type>
+void benchmarkFloat4Operation(benchmark::State& state) {
+	const auto inputs = validationInputs();
+	auto lhs = Float4Type(inputs[0]);
+	const auto rhs = Float4Type(inputs[1]);
+	const auto operation = Operation();
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(lhs = operation(lhs, rhs));
+	}
+
+	if constexpr (std::is_same_v<Float4Type, Float4>) {
+		state.counters["maxUlps"] = maxUlpsFromReference(operation);
+	}
+}
+
+BENCHMARK_TEMPLATE(benchmarkFloat4Operation, Add, Float4);
+BENCHMARK_TEMPLATE(benchmarkFloat4Operation, Add, ReferenceFloat4);
+BENCHMARK_TEMPLATE(benchmarkFloat4Operation, Subtract, Float4);
+BENCHMARK_TEMPLATE(benchmarkFloat4Operation, Subtract, ReferenceFloat4);
+BENCHMARK_TEMPLATE(benchmarkFloat4Operation, Multiply, Float4);
+BENCHMARK_TEMPLATE(benchmarkFloat4Operation, Multiply, ReferenceFloat4);
+BENCHMARK_TEMPLATE(benchmarkFloat4Operation, Divide, Float4);
+BENCHMARK_TEMPLATE(benchmarkFloat4Operation, Divide, ReferenceFloat4);
+BENCHMARK_TEMPLATE(benchmarkFloat4Operation, Madd, Float4);
+BENCHMARK_TEMPLATE(benchmarkFloat4Operation, Madd, ReferenceFloat4);
+BENCHMARK_TEMPLATE(benchmarkFloat4Operation, Dot, Float4);
+BENCHMARK_TEMPLATE(benchmarkFloat4Operation, Dot, ReferenceFloat4);
+BENCHMARK_TEMPLATE(benchmarkFloat4Operation, Normalise, Float4);
+BENCHMARK_TEMPLATE(benchmarkFloat4Operation, Normalise, ReferenceFloat4);
+BENCHMARK_TEMPLATE(benchmarkFloat4Operation, NormaliseFast, Float4);
+BENCHMARK_TEMPLATE(benchmarkFloat4Operation, NormaliseFast, ReferenceFloat4);
+BENCHMARK_TEMPLATE(benchmarkFloat4Operation, CombineColumns, Float4);
+BENCHMARK_TEMPLATE(benchmarkFloat4Operation, CombineColumns, ReferenceFloat4);
+
+} // anonymous namespace
@@ -17,6 +17,8 @@ function link_googlebenchmark_lib()
 	links "benchmark"
 	filter "platforms:Win*"
 		links "Shlwapi"
+	filter "platforms:Linux*"
+		links "pthread"
 	filter {}
 end
 
@@ -6,13 +6,23 @@ include "googlebenchmark.lua"
 
 ROOT_DIR = path.getabsolute(".")
 
+newoption {
+	trigger = "simd-reference",
+	description = "Use the portable reference implementation of simd types instead of compiler intrinsics"
+}
+
+newoption {
+	trigger = "simd-avx2",
+	description = "Target AVX2 and FMA, enabling the 256-bit Float8 implementation"
+}
+
 location "build"	
 
 workspace "caramel-math"
 
 	configurations { "DebugStatic", "DebugMemcheckStatic", "ProfileBuildTimes", "ReleaseStatic" }
 	
-	platforms { "Win64" }
+	platforms { "Win64", "Linux64" }
 	
 	language "C++"
 
@@ -41,6 +51,10 @@ workspace "caramel-math"
 	filter "platforms:Win64"
 		system "Windows"
 		architecture "x64"
+
+	filter "platforms:Linux64"
+		system "Linux"
+		architecture "x64"
 		
 	filter {}
 	
@@ -51,16 +65,36 @@ workspace "caramel-math"
 	
 	flags { "MultiProcessorCompile" }
 	
+	if _OPTIONS["simd-reference"] then
+		defines { "CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION" }
+	end
+	
+	if _OPTIONS["simd-avx2"] then
+		vectorextensions "AVX2"
+		filter "action:gmake*"
+			buildoptions { "-mfma" }
+		filter {}
+	end
+	
 	filter "action:vs*"
 		defines { "_SCL_SECURE_NO_WARNINGS" }
 		buildoptions { "/std:c++latest" }
 		defines { "GTEST_LANG_CXX11=1" }
+	filter "action:gmake*"
+		buildoptions { "-std=c++17" }
 	filter {}
 
 	structure.header_project("caramel-math", "src")
 	
 	structure.executable_project("caramel-math-test", "test", false, function()
 			use_googletest()
+			
+			-- GCC fuses multiplications and additions into FMAs by default when the target has them, which makes
+			-- the scalar reference implementations of simd types round differently from the native ones. Only
+			-- the tests turn this off, the benchmarks measure the scalar code as users build it.
+			filter "action:gmake*"
+				buildoptions { "-ffp-contract=off" }
+			filter {}
 		end
 		)
 
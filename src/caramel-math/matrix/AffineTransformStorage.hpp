@@ -2,6 +2,7 @@
 #define CARAMELMATH_MATRIX_AFFINETRANSFORMSTORAGE_HPP__
 
 #include <array>
+#include <cstddef>
 
 #include "../setup.hpp"
 #include "matrix-coordinates.hpp"
@@ -25,6 +26,15 @@ public:
 
 	static constexpr auto COLUMNS = 4;
 
+	static constexpr auto MAJOR_ORDER = MajorOrder::ROW;
+
+	static constexpr auto ROW_STRIDE = size_t(COLUMNS);
+
+	static constexpr auto COLUMN_STRIDE = size_t(1);
+
+	// The last row is implicitly { 0, 0, 0, 1 } and not stored.
+	static constexpr auto STORED_ELEMENTS = size_t((ROWS - 1) * COLUMNS);
+
 	using GetReturnType = std::conditional_t<
 		std::is_arithmetic_v<Scalar>,
 		std::add_const_t<Scalar>, 
@@ -65,11 +75,11 @@ public:
 	}
 
 	GetReturnType get(Row row, Column column) const noexcept(
-		noexcept(ErrorHandler::invalidAccess<GetReturnType>(row, column)))
+		noexcept(ErrorHandler::template invalidAccess<GetReturnType>(row, column)))
 	{
 		if constexpr (RUNTIME_CHECKS) {
 			if (row.value() >= ROWS || column.value() >= COLUMNS) {
-				return ErrorHandler::invalidAccess<GetReturnType>(row, column);
+				return ErrorHandler::template invalidAccess<GetReturnType>(row, column);
 			}
 		}
 
@@ -85,11 +95,11 @@ public:
 	}
 
 	void set(Row row, Column column, Scalar scalar) noexcept(
-		noexcept(ErrorHandler::invalidAccess<GetReturnType>(row, column)))
+		noexcept(ErrorHandler::template invalidAccess<GetReturnType>(row, column)))
 	{
 		if constexpr (RUNTIME_CHECKS) {
 			if (row.value() >= ROWS || column.value() >= COLUMNS) {
-				ErrorHandler::invalidAccess<GetReturnType>(row, column);
+				ErrorHandler::template invalidAccess<GetReturnType>(row, column);
 				return;
 			}
 		}
@@ -109,9 +119,17 @@ public:
 		data_[row.value() * COLUMNS + column.value()] = std::move(scalar);
 	}
 
+	Scalar* data() noexcept {
+		return data_.data();
+	}
+
+	const Scalar* data() const noexcept {
+		return data_.data();
+	}
+
 private:
 
-	std::array<Scalar, (ROWS - 1) * COLUMNS> data_;
+	std::array<Scalar, STORED_ELEMENTS> data_;
 
 };
 
@@ -2,18 +2,24 @@
 #define CARAMELMATH_MATRIX_ARRAYSTORAGE_HPP__
 
 #include <array>
+#include <cstddef>
+#include <type_traits>
 
 #include "../detail/helper-type-traits.hpp"
 #include "../setup.hpp"
 #include "matrix-coordinates.hpp"
+#include "matrixfwd.hpp"
 
 namespace caramel_math::matrix {
 
+// Keeps the elements in an array, row after row by default. Column-major storages are what transposed() yields
+// for row-major ones: the same array, read with the strides swapped.
 template <
 	class ScalarTraitsType,
 	size_t ROWS_VALUE,
 	size_t COLUMNS_VALUE,
-	class ErrorHandlerType
+	class ErrorHandlerType,
+	MajorOrder MAJOR_ORDER_VALUE
 	>
 class ArrayStorage {
 public:
@@ -28,6 +34,14 @@ public:
 
 	static constexpr auto COLUMNS = COLUMNS_VALUE;
 
+	static constexpr auto MAJOR_ORDER = MAJOR_ORDER_VALUE;
+
+	static constexpr auto ROW_STRIDE = (MAJOR_ORDER == MajorOrder::ROW) ? COLUMNS : size_t(1);
+
+	static constexpr auto COLUMN_STRIDE = (MAJOR_ORDER == MajorOrder::ROW) ? size_t(1) : ROWS;
+
+	static constexpr auto STORED_ELEMENTS = ROWS * COLUMNS;
+
 	using GetReturnType = std::conditional_t<
 		std::is_arithmetic_v<Scalar>,
 		std::add_const_t<Scalar>,
@@ -36,43 +50,67 @@ public:
 
 	ArrayStorage() = default;
 
+	// Values are listed row after row, whatever the major order.
 	template <
 		class... CompatibleValues,
 		typename = std::enable_if_t<caramel_math::detail::AllConvertibleV<Scalar, CompatibleValues...>>
 		>
 	explicit ArrayStorage(CompatibleValues&&... values) noexcept :
-		data_{ std::forward<CompatibleValues>(values)... }
+		data_(storedOrder({ std::forward<CompatibleValues>(values)... }))
 	{
 		static_assert(sizeof...(values) == ROWS * COLUMNS);
 	}
 
 	GetReturnType get(Row row, Column column) const noexcept(
-		noexcept(ErrorHandler::invalidAccess<GetReturnType>(row, column)))
+		noexcept(ErrorHandler::template invalidAccess<GetReturnType>(row, column)))
 	{
 		if constexpr (RUNTIME_CHECKS) {
 			if (row.value() >= ROWS || column.value() >= COLUMNS) {
-				return ErrorHandler::invalidAccess<GetReturnType>(row, column);
+				return ErrorHandler::template invalidAccess<GetReturnType>(row, column);
 			}
 		}
-		return data_[row.value() * COLUMNS + column.value()];
+		return data_[row.value() * ROW_STRIDE + column.value() * COLUMN_STRIDE];
 	}
 
 	void set(Row row, Column column, Scalar scalar) noexcept(
-		noexcept(ErrorHandler::invalidAccess<GetReturnType>(row, column)))
+		noexcept(ErrorHandler::template invalidAccess<GetReturnType>(row, column)))
 	{
 		if constexpr (RUNTIME_CHECKS) {
 			if (row.value() >= ROWS || column.value() >= COLUMNS) {
-				ErrorHandler::invalidAccess<GetReturnType>(row, column);
+				ErrorHandler::template invalidAccess<GetReturnType>(row, column);
 				return;
 			}
 		}
-		data_[row.value() * COLUMNS + column.value()] = std::move(scalar);
+		data_[row.value() * ROW_STRIDE + column.value() * COLUMN_STRIDE] = std::move(scalar);
+	}
+
+	Scalar* data() noexcept {
+		return data_.data();
+	}
+
+	const Scalar* data() const noexcept {
+		return data_.data();
 	}
 
 private:
 
 	std::array<Scalar, ROWS * COLUMNS> data_;
 
+	static std::array<Scalar, ROWS * COLUMNS> storedOrder(std::array<Scalar, ROWS * COLUMNS> rowMajorValues) noexcept {
+		if constexpr (MAJOR_ORDER == MajorOrder::ROW) {
+			return rowMajorValues;
+		} else {
+			auto storedValues = std::array<Scalar, ROWS * COLUMNS>();
+			for (auto rowIdx = size_t(0); rowIdx < ROWS; ++rowIdx) {
+				for (auto columnIdx = size_t(0); columnIdx < COLUMNS; ++columnIdx) {
+					storedValues[rowIdx * ROW_STRIDE + columnIdx * COLUMN_STRIDE] =
+						std::move(rowMajorValues[rowIdx * COLUMNS + columnIdx]);
+				}
+			}
+			return storedValues;
+		}
+	}
+
 };
 
 } // namespace caramel_math::matrix
@@ -29,6 +29,14 @@ struct AssertErrorHandler final {
 		assert(!"Invalid matrix data value");
 	}
 
+	template <class ReturnType>
+	static ReturnType overflow() noexcept {
+		assert(!"Matrix arithmetic overflow");
+
+		static auto returnValue = std::decay_t<ReturnType>();
+		return returnValue;
+	}
+
 };
 
 } // namespace caramel_math::matrix
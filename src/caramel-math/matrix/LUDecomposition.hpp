@@ -0,0 +1,184 @@
+#ifndef CARAMELMATH_MATRIX_LUDECOMPOSITION_HPP__
+#define CARAMELMATH_MATRIX_LUDECOMPOSITION_HPP__
+
+#include <array>
+#include <cmath>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "../setup.hpp"
+#include "matrix-coordinates.hpp"
+#include "Matrix.template.hpp"
+#include "storage-traits.hpp"
+
+namespace caramel_math::matrix {
+
+// Factorization P * A = L * U of a square matrix, with partial pivoting. L has an implicit unit diagonal and
+// is stored below the diagonal of U. Factorizing costs O(n^3) once; the determinant is then O(n) and solve()
+// O(n^2) per right-hand side column, so a single decomposition serves any number of systems.
+template <class StorageType>
+class LUDecomposition {
+public:
+
+	using Scalar = typename StorageType::Scalar;
+
+	using ResultStorage = EffectiveStorageType<StorageType>;
+
+	static constexpr auto SIZE = StorageType::ROWS;
+
+	static_assert(StorageType::ROWS == StorageType::COLUMNS, "LU decomposition only defined for square matrices");
+
+	static_assert(std::is_floating_point_v<Scalar>, "LU decomposition only defined for floating point scalars");
+
+	explicit LUDecomposition(const Matrix<StorageType>& matrix) noexcept(noexcept(matrix.get(Row(0), Column(0)))) {
+		for (auto rowIdx = size_t(0); rowIdx < SIZE; ++rowIdx) {
+			permutation_[rowIdx] = rowIdx;
+			for (auto columnIdx = size_t(0); columnIdx < SIZE; ++columnIdx) {
+				at(rowIdx, columnIdx) = matrix.get(Row(rowIdx), Column(columnIdx));
+			}
+		}
+
+		for (auto pivotIdx = size_t(0); pivotIdx < SIZE; ++pivotIdx) {
+			auto maxRowIdx = pivotIdx;
+			for (auto rowIdx = pivotIdx + 1; rowIdx < SIZE; ++rowIdx) {
+				if (std::abs(at(rowIdx, pivotIdx)) > std::abs(at(maxRowIdx, pivotIdx))) {
+					maxRowIdx = rowIdx;
+				}
+			}
+
+			if (at(maxRowIdx, pivotIdx) == Scalar(0)) {
+				singular_ = true;
+				continue;
+			}
+
+			if (maxRowIdx != pivotIdx) {
+				for (auto columnIdx = size_t(0); columnIdx < SIZE; ++columnIdx) {
+					std::swap(at(pivotIdx, columnIdx), at(maxRowIdx, columnIdx));
+				}
+				std::swap(permutation_[pivotIdx], permutation_[maxRowIdx]);
+				oddPermutation_ = !oddPermutation_;
+			}
+
+			const auto pivot = at(pivotIdx, pivotIdx);
+			for (auto rowIdx = pivotIdx + 1; rowIdx < SIZE; ++rowIdx) {
+				const auto factor = at(rowIdx, pivotIdx) / pivot;
+				at(rowIdx, pivotIdx) = factor;
+				for (auto columnIdx = pivotIdx + 1; columnIdx < SIZE; ++columnIdx) {
+					at(rowIdx, columnIdx) -= factor * at(pivotIdx, columnIdx);
+				}
+			}
+		}
+	}
+
+	// A zero pivot was found, so determinant() is zero and solve() and inverse() yield empty optionals.
+	bool singular() const noexcept {
+		return singular_;
+	}
+
+	Scalar determinant() const noexcept {
+		if (singular_) {
+			return Scalar(0);
+		}
+
+		auto result = oddPermutation_ ? Scalar(-1) : Scalar(1);
+		for (auto diagonalIdx = size_t(0); diagonalIdx < SIZE; ++diagonalIdx) {
+			result *= at(diagonalIdx, diagonalIdx);
+		}
+
+		return result;
+	}
+
+	// Solves A * X = B for every column of B.
+	template <class RHSStorageType>
+	auto solve(const Matrix<RHSStorageType>& rhs) const noexcept(noexcept(rhs.get(Row(0), Column(0))))
+		-> std::optional<Matrix<EffectiveStorageType<RHSStorageType>>>
+	{
+		static_assert(RHSStorageType::ROWS == SIZE, "Incompatible matrix sizes for solving");
+
+		auto result = std::optional<Matrix<EffectiveStorageType<RHSStorageType>>>();
+
+		if (!singular_) {
+			result.emplace();
+
+			for (auto columnIdx = Column(0); columnIdx.value() < RHSStorageType::COLUMNS; ++columnIdx) {
+				auto column = std::array<Scalar, SIZE>();
+				for (auto rowIdx = size_t(0); rowIdx < SIZE; ++rowIdx) {
+					column[rowIdx] = rhs.get(Row(permutation_[rowIdx]), columnIdx);
+				}
+
+				substitute(column);
+
+				for (auto rowIdx = size_t(0); rowIdx < SIZE; ++rowIdx) {
+					result->set(Row(rowIdx), columnIdx, column[rowIdx]);
+				}
+			}
+		}
+
+		return result;
+	}
+
+	// Solves A * X = I, without materializing the identity matrix.
+	std::optional<Matrix<ResultStorage>> inverse() const noexcept {
+		auto result = std::optional<Matrix<ResultStorage>>();
+
+		if (!singular_) {
+			result.emplace();
+
+			for (auto columnIdx = size_t(0); columnIdx < SIZE; ++columnIdx) {
+				auto column = std::array<Scalar, SIZE>();
+				for (auto rowIdx = size_t(0); rowIdx < SIZE; ++rowIdx) {
+					column[rowIdx] = (permutation_[rowIdx] == columnIdx) ? Scalar(1) : Scalar(0);
+				}
+
+				substitute(column);
+
+				for (auto rowIdx = size_t(0); rowIdx < SIZE; ++rowIdx) {
+					result->set(Row(rowIdx), Column(columnIdx), column[rowIdx]);
+				}
+			}
+		}
+
+		return result;
+	}
+
+private:
+
+	std::array<Scalar, SIZE * SIZE> lu_;
+
+	std::array<size_t, SIZE> permutation_;
+
+	bool oddPermutation_ = false;
+
+	bool singular_ = false;
+
+	Scalar& at(size_t row, size_t column) noexcept {
+		return lu_[row * SIZE + column];
+	}
+
+	const Scalar& at(size_t row, size_t column) const noexcept {
+		return lu_[row * SIZE + column];
+	}
+
+	// Overwrites an already permuted right-hand side column with the solution, by forward substitution
+	// through L followed by back substitution through U.
+	void substitute(std::array<Scalar, SIZE>& column) const noexcept {
+		for (auto rowIdx = size_t(1); rowIdx < SIZE; ++rowIdx) {
+			for (auto columnIdx = size_t(0); columnIdx < rowIdx; ++columnIdx) {
+				column[rowIdx] -= at(rowIdx, columnIdx) * column[columnIdx];
+			}
+		}
+
+		for (auto rowIdx = SIZE; rowIdx-- > 0;) {
+			for (auto columnIdx = rowIdx + 1; columnIdx < SIZE; ++columnIdx) {
+				column[rowIdx] -= at(rowIdx, columnIdx) * column[columnIdx];
+			}
+			column[rowIdx] /= at(rowIdx, rowIdx);
+		}
+	}
+
+};
+
+} // namespace caramel_math::matrix
+
+#endif /* CARAMELMATH_MATRIX_LUDECOMPOSITION_HPP__ */
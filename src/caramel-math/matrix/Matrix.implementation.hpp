@@ -1,9 +1,16 @@
 #ifndef CARAMELMATH_MATRIX_MATRIX_IMPLEMENTATION_HPP__
 #define CARAMELMATH_MATRIX_MATRIX_IMPLEMENTATION_HPP__
 
-#include <iosfwd>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ostream>
 #include <optional>
+#include <type_traits>
+#include <utility>
 
+#include "LUDecomposition.hpp"
 #include "Matrix.template.hpp"
 #include "ViewStorage.hpp"
 #include "storage-traits.hpp"
@@ -17,9 +24,16 @@ namespace detail {
 template <class StorageType>
 Matrix<StorageType> zeroMatrix() {
 	auto zero = Matrix<StorageType>();
-	for (auto rowIdx = Row(0); rowIdx.value() < StorageType::ROWS; ++rowIdx) {
-		for (auto columnIdx = Column(0); columnIdx.value() < StorageType::COLUMNS; ++columnIdx) {
-			zero.set(rowIdx, columnIdx, StorageType::ScalarTraits::ZERO);
+	if constexpr (HasDenseLayout<StorageType>::VALUE) {
+		auto* data = zero.storage().data();
+		for (auto index = size_t(0); index < StorageType::STORED_ELEMENTS; ++index) {
+			data[index] = StorageType::ScalarTraits::ZERO;
+		}
+	} else {
+		for (auto rowIdx = Row(0); rowIdx.value() < StorageType::ROWS; ++rowIdx) {
+			for (auto columnIdx = Column(0); columnIdx.value() < StorageType::COLUMNS; ++columnIdx) {
+				zero.set(rowIdx, columnIdx, StorageType::ScalarTraits::ZERO);
+			}
 		}
 	}
 	return zero;
@@ -27,17 +41,26 @@ Matrix<StorageType> zeroMatrix() {
 
 template <class StorageType>
 Matrix<StorageType> identityMatrix() {
-	auto zero = Matrix<StorageType>();
-	for (auto rowIdx = Row(0); rowIdx.value() < StorageType::ROWS; ++rowIdx) {
-		for (auto columnIdx = Column(0); columnIdx.value() < StorageType::COLUMNS; ++columnIdx) {
-			if (rowIdx.value() == columnIdx.value()) {
-				zero.set(rowIdx, columnIdx, StorageType::ScalarTraits::ONE);
-			} else {
-				zero.set(rowIdx, columnIdx, StorageType::ScalarTraits::ZERO);
+	if constexpr (HasDenseLayout<StorageType>::VALUE && StorageType::ROWS == StorageType::COLUMNS) {
+		auto identity = zeroMatrix<StorageType>();
+		auto* data = identity.storage().data();
+		for (auto diagonalIdx = size_t(0); diagonalIdx < StorageType::ROWS; ++diagonalIdx) {
+			data[diagonalIdx * (StorageType::ROW_STRIDE + StorageType::COLUMN_STRIDE)] = StorageType::ScalarTraits::ONE;
+		}
+		return identity;
+	} else {
+		auto zero = Matrix<StorageType>();
+		for (auto rowIdx = Row(0); rowIdx.value() < StorageType::ROWS; ++rowIdx) {
+			for (auto columnIdx = Column(0); columnIdx.value() < StorageType::COLUMNS; ++columnIdx) {
+				if (rowIdx.value() == columnIdx.value()) {
+					zero.set(rowIdx, columnIdx, StorageType::ScalarTraits::ONE);
+				} else {
+					zero.set(rowIdx, columnIdx, StorageType::ScalarTraits::ZERO);
+				}
 			}
 		}
+		return zero;
 	}
-	return zero;
 }
 
 } // namespace detail
@@ -51,7 +74,7 @@ Matrix<StorageType> Matrix<StorageType>::IDENTITY = detail::identityMatrix<Stora
 // -- operators
 
 template <class LHSStorageType, class RHSStorageType>
-inline [[nodiscard]] bool operator==(
+[[nodiscard]] inline bool operator==(
 	const Matrix<LHSStorageType>& lhs,
 	const Matrix<RHSStorageType>& rhs
 	) noexcept(noexcept(lhs.get(Row(0), Column(0))) && noexcept(rhs.get(Row(0), Column(0))))
@@ -62,20 +85,38 @@ inline [[nodiscard]] bool operator==(
 		"Incompatible matrix sizes for equality test"
 		);
 
-	for (auto rowIdx = Row(0); rowIdx.value() < LHSStorageType::ROWS; ++rowIdx) {
-		for (auto columnIdx = Column(0); columnIdx.value() < LHSStorageType::COLUMNS; ++columnIdx) {
-			using ScalarTraits = typename LHSStorageType::ScalarTraits;
-			if (!ScalarTraits::equal(lhs.get(rowIdx, columnIdx), rhs.get(rowIdx, columnIdx))) {
+	using ScalarTraits = typename LHSStorageType::ScalarTraits;
+
+	// Affine transforms agree on their implicit last row, so comparing the stored elements suffices.
+	if constexpr (
+		detail::HaveSameContiguousLayout<LHSStorageType, RHSStorageType>::VALUE &&
+		(detail::HasDenseLayout<LHSStorageType>::VALUE ||
+			(detail::IsAffineTransformStorage<LHSStorageType>::VALUE &&
+				detail::IsAffineTransformStorage<RHSStorageType>::VALUE))
+		)
+	{
+		const auto* lhsData = lhs.storage().data();
+		const auto* rhsData = rhs.storage().data();
+		for (auto index = size_t(0); index < LHSStorageType::STORED_ELEMENTS; ++index) {
+			if (!ScalarTraits::equal(lhsData[index], rhsData[index])) {
 				return false;
 			}
 		}
+	} else {
+		for (auto rowIdx = Row(0); rowIdx.value() < LHSStorageType::ROWS; ++rowIdx) {
+			for (auto columnIdx = Column(0); columnIdx.value() < LHSStorageType::COLUMNS; ++columnIdx) {
+				if (!ScalarTraits::equal(lhs.get(rowIdx, columnIdx), rhs.get(rowIdx, columnIdx))) {
+					return false;
+				}
+			}
+		}
 	}
 
 	return true;
 }
 
 template <class LHSStorageType, class RHSStorageType>
-inline [[nodiscard]] bool operator!=(
+[[nodiscard]] inline bool operator!=(
 	const Matrix<LHSStorageType>& lhs,
 	const Matrix<RHSStorageType>& rhs
 	) noexcept(noexcept(lhs == rhs))
@@ -83,32 +124,240 @@ inline [[nodiscard]] bool operator!=(
 	return !(lhs == rhs);
 }
 
-template <class LHSStorageType, class RHSStorageType>
-inline [[nodiscard]] auto operator*(
+namespace detail {
+
+// Products with at most this many scalar multiplications (e.g. 4x4 by 4x4) are unrolled at compile time.
+constexpr auto MAX_UNROLLED_PRODUCT_TERMS = size_t(64);
+
+// Element access by compile-time indices, straight from the array of dense layouts.
+template <size_t ROW, size_t COLUMN, class StorageType>
+auto element(const Matrix<StorageType>& matrix) noexcept(noexcept(matrix.get(Row(0), Column(0)))) {
+	if constexpr (HasDenseLayout<StorageType>::VALUE) {
+		return matrix.storage().data()[ROW * StorageType::ROW_STRIDE + COLUMN * StorageType::COLUMN_STRIDE];
+	} else {
+		return matrix.get(Row(ROW), Column(COLUMN));
+	}
+}
+
+template <size_t ROW, size_t COLUMN, class LHSStorageType, class RHSStorageType, size_t... DOT_INDICES>
+auto unrolledDot(
 	const Matrix<LHSStorageType>& lhs,
-	const Matrix<RHSStorageType>& rhs
+	const Matrix<RHSStorageType>& rhs,
+	std::index_sequence<DOT_INDICES...>
+	) noexcept(noexcept(lhs.get(Row(0), Column(0))) && noexcept(rhs.get(Row(0), Column(0))))
+{
+	return (... + (element<ROW, DOT_INDICES>(lhs) * element<DOT_INDICES, COLUMN>(rhs)));
+}
+
+// All elements are computed before any is stored, so the compiler needn't assume that the stores modify the
+// operands and may vectorize across elements.
+template <
+	class ResultStorageType,
+	class LHSStorageType,
+	class RHSStorageType,
+	class ScaleType,
+	size_t... ELEMENT_INDICES
+	>
+void unrolledMultiply(
+	Matrix<ResultStorageType>& result,
+	const Matrix<LHSStorageType>& lhs,
+	const Matrix<RHSStorageType>& rhs,
+	const ScaleType& scale,
+	std::index_sequence<ELEMENT_INDICES...>
+	) noexcept(noexcept(lhs.get(Row(0), Column(0))) && noexcept(rhs.get(Row(0), Column(0))))
+{
+	constexpr auto COLUMNS = ResultStorageType::COLUMNS;
+	const auto dotIndices = std::make_index_sequence<LHSStorageType::COLUMNS>();
+
+	const auto elements = std::array<typename ResultStorageType::Scalar, sizeof...(ELEMENT_INDICES)>{
+		scale(static_cast<typename ResultStorageType::Scalar>(
+			unrolledDot<ELEMENT_INDICES / COLUMNS, ELEMENT_INDICES % COLUMNS>(lhs, rhs, dotIndices)))...
+	};
+
+	if constexpr (HasDenseLayout<ResultStorageType>::VALUE) {
+		auto* resultData = result.storage().data();
+		((resultData[
+			(ELEMENT_INDICES / COLUMNS) * ResultStorageType::ROW_STRIDE +
+			(ELEMENT_INDICES % COLUMNS) * ResultStorageType::COLUMN_STRIDE
+			] = elements[ELEMENT_INDICES]), ...);
+	} else {
+		(result.set(Row(ELEMENT_INDICES / COLUMNS), Column(ELEMENT_INDICES % COLUMNS), elements[ELEMENT_INDICES]), ...);
+	}
+}
+
+// Computes every element of a dense result as a dot product over raw arrays. The loop over the major order of the
+// result is outermost, so consecutive elements written are independent and the compiler may vectorize across them.
+template <
+	class ResultStorageType,
+	size_t DOT_SIZE,
+	size_t LHS_ROW_STRIDE,
+	size_t LHS_COLUMN_STRIDE,
+	size_t RHS_ROW_STRIDE,
+	size_t RHS_COLUMN_STRIDE,
+	class LHSScalar,
+	class RHSScalar,
+	class ScaleType
+	>
+void denseDotLoops(
+	typename ResultStorageType::Scalar* resultData,
+	const LHSScalar* lhsData,
+	const RHSScalar* rhsData,
+	const ScaleType& scale
+	) noexcept
+{
+	constexpr auto ROW_MAJOR = (ResultStorageType::MAJOR_ORDER == MajorOrder::ROW);
+	constexpr auto OUTER_SIZE = ROW_MAJOR ? ResultStorageType::ROWS : ResultStorageType::COLUMNS;
+	constexpr auto INNER_SIZE = ROW_MAJOR ? ResultStorageType::COLUMNS : ResultStorageType::ROWS;
+
+	for (auto outerIdx = size_t(0); outerIdx < OUTER_SIZE; ++outerIdx) {
+		for (auto innerIdx = size_t(0); innerIdx < INNER_SIZE; ++innerIdx) {
+			const auto rowIdx = ROW_MAJOR ? outerIdx : innerIdx;
+			const auto columnIdx = ROW_MAJOR ? innerIdx : outerIdx;
+
+			auto dot = ResultStorageType::ScalarTraits::ZERO;
+			for (auto dotIdx = size_t(0); dotIdx < DOT_SIZE; ++dotIdx) {
+				dot +=
+					lhsData[rowIdx * LHS_ROW_STRIDE + dotIdx * LHS_COLUMN_STRIDE] *
+					rhsData[dotIdx * RHS_ROW_STRIDE + columnIdx * RHS_COLUMN_STRIDE];
+			}
+			resultData[rowIdx * ResultStorageType::ROW_STRIDE + columnIdx * ResultStorageType::COLUMN_STRIDE] = scale(dot);
+		}
+	}
+}
+
+// Multiplies dense layouts by looping over their arrays. Vectorizing across the elements of the result needs the
+// operand whose elements vary along its major order to share that order, so it is first copied to it if it
+// doesn't (e.g. rhs in a * transposed(b) with a row-major result), costing O(n^2) against the O(n^3) product.
+template <class ResultStorageType, class LHSStorageType, class RHSStorageType, class ScaleType>
+void denseMultiply(
+	Matrix<ResultStorageType>& result,
+	const Matrix<LHSStorageType>& lhs,
+	const Matrix<RHSStorageType>& rhs,
+	const ScaleType& scale
+	) noexcept(noexcept(lhs.get(Row(0), Column(0))) && noexcept(rhs.get(Row(0), Column(0))))
+{
+	constexpr auto ROWS = LHSStorageType::ROWS;
+	constexpr auto COLUMNS = RHSStorageType::COLUMNS;
+	constexpr auto DOT_SIZE = LHSStorageType::COLUMNS;
+
+	auto* resultData = result.storage().data();
+	const auto* lhsData = lhs.storage().data();
+	const auto* rhsData = rhs.storage().data();
+
+	if constexpr (
+		ResultStorageType::MAJOR_ORDER == MajorOrder::ROW &&
+		RHSStorageType::MAJOR_ORDER != MajorOrder::ROW
+		)
+	{
+		auto rowMajorRhs = std::array<typename RHSStorageType::Scalar, DOT_SIZE * COLUMNS>();
+		for (auto rowIdx = size_t(0); rowIdx < DOT_SIZE; ++rowIdx) {
+			for (auto columnIdx = size_t(0); columnIdx < COLUMNS; ++columnIdx) {
+				rowMajorRhs[rowIdx * COLUMNS + columnIdx] =
+					rhsData[rowIdx * RHSStorageType::ROW_STRIDE + columnIdx * RHSStorageType::COLUMN_STRIDE];
+			}
+		}
+
+		denseDotLoops<
+			ResultStorageType,
+			DOT_SIZE,
+			LHSStorageType::ROW_STRIDE,
+			LHSStorageType::COLUMN_STRIDE,
+			COLUMNS,
+			1
+			>(resultData, lhsData, rowMajorRhs.data(), scale);
+	} else if constexpr (
+		ResultStorageType::MAJOR_ORDER == MajorOrder::COLUMN &&
+		LHSStorageType::MAJOR_ORDER != MajorOrder::COLUMN
+		)
+	{
+		auto columnMajorLhs = std::array<typename LHSStorageType::Scalar, ROWS * DOT_SIZE>();
+		for (auto columnIdx = size_t(0); columnIdx < DOT_SIZE; ++columnIdx) {
+			for (auto rowIdx = size_t(0); rowIdx < ROWS; ++rowIdx) {
+				columnMajorLhs[columnIdx * ROWS + rowIdx] =
+					lhsData[rowIdx * LHSStorageType::ROW_STRIDE + columnIdx * LHSStorageType::COLUMN_STRIDE];
+			}
+		}
+
+		denseDotLoops<
+			ResultStorageType,
+			DOT_SIZE,
+			1,
+			ROWS,
+			RHSStorageType::ROW_STRIDE,
+			RHSStorageType::COLUMN_STRIDE
+			>(resultData, columnMajorLhs.data(), rhsData, scale);
+	} else {
+		denseDotLoops<
+			ResultStorageType,
+			DOT_SIZE,
+			LHSStorageType::ROW_STRIDE,
+			LHSStorageType::COLUMN_STRIDE,
+			RHSStorageType::ROW_STRIDE,
+			RHSStorageType::COLUMN_STRIDE
+			>(resultData, lhsData, rhsData, scale);
+	}
+}
+
+// Small products are generated as straight-line code indexing every element by a constant, larger ones loop.
+// Storages with kernels of their own overload this for their operands, taking the scale the same way.
+template <class LHSStorageType, class RHSStorageType, class ScaleType>
+[[nodiscard]] inline auto scaledProduct(
+	const Matrix<LHSStorageType>& lhs,
+	const Matrix<RHSStorageType>& rhs,
+	const ScaleType& scale
 	) noexcept(noexcept(lhs.get(Row(0), Column(0))) && noexcept(rhs.get(Row(0), Column(0))))
 {
 	static_assert(LHSStorageType::COLUMNS == RHSStorageType::ROWS, "Incompatible matrix sizes for multiplication");
 	using ResultStorageType =
-		BinaryOperatorResultType<LHSStorageType, RHSStorageType, LHSStorageType::ROWS, RHSStorageType::COLUMNS>;
+		matrix::BinaryOperatorResultType<LHSStorageType, RHSStorageType, LHSStorageType::ROWS, RHSStorageType::COLUMNS>;
 	using ResultType = Matrix<ResultStorageType>;
 
 	auto result = ResultType();
 
-	for (auto rowIdx = Row(0); rowIdx.value() < LHSStorageType::ROWS; ++rowIdx) {
-		for (auto columnIdx = Column(0); columnIdx.value() < RHSStorageType::COLUMNS; ++columnIdx) {
-			auto dot = ResultType::ScalarTraits::ZERO;
-			for (auto dotIdx = 0u; dotIdx < LHSStorageType::COLUMNS; ++dotIdx) {
-				dot += lhs.get(rowIdx, Column(dotIdx)) * rhs.get(Row(dotIdx), columnIdx);
+	constexpr auto TERMS = LHSStorageType::ROWS * LHSStorageType::COLUMNS * RHSStorageType::COLUMNS;
+
+	if constexpr (TERMS <= MAX_UNROLLED_PRODUCT_TERMS) {
+		unrolledMultiply(
+			result,
+			lhs,
+			rhs,
+			scale,
+			std::make_index_sequence<LHSStorageType::ROWS * RHSStorageType::COLUMNS>()
+			);
+	} else if constexpr (
+		HasDenseLayout<ResultStorageType>::VALUE &&
+		HasDenseLayout<LHSStorageType>::VALUE &&
+		HasDenseLayout<RHSStorageType>::VALUE
+		)
+	{
+		denseMultiply(result, lhs, rhs, scale);
+	} else {
+		for (auto rowIdx = Row(0); rowIdx.value() < LHSStorageType::ROWS; ++rowIdx) {
+			for (auto columnIdx = Column(0); columnIdx.value() < RHSStorageType::COLUMNS; ++columnIdx) {
+				auto dot = ResultStorageType::ScalarTraits::ZERO;
+				for (auto dotIdx = 0u; dotIdx < LHSStorageType::COLUMNS; ++dotIdx) {
+					dot += lhs.get(rowIdx, Column(dotIdx)) * rhs.get(Row(dotIdx), columnIdx);
+				}
+				result.set(rowIdx, columnIdx, scale(dot));
 			}
-			result.set(rowIdx, columnIdx, dot);
 		}
 	}
 
 	return result;
 }
 
+} // namespace detail
+
+// Found through argument-dependent lookup, so overloads of scaledProduct declared after this apply as well.
+template <class LHSStorageType, class RHSStorageType>
+[[nodiscard]] inline auto operator*(
+	const Matrix<LHSStorageType>& lhs,
+	const Matrix<RHSStorageType>& rhs
+	) noexcept(noexcept(scaledProduct(lhs, rhs, detail::Unscaled())))
+{
+	return scaledProduct(lhs, rhs, detail::Unscaled());
+}
+
 template <class LHSStorageType, class RHSStorageType>
 inline auto& operator*=(
 	Matrix<LHSStorageType>& lhs,
@@ -120,13 +369,177 @@ inline auto& operator*=(
 	return lhs;
 }
 
+template <class LHSStorageType, class RHSStorageType>
+inline auto& operator+=(
+	Matrix<LHSStorageType>& lhs,
+	const Matrix<RHSStorageType>& rhs
+	) noexcept(noexcept(lhs.get(Row(0), Column(0))) && noexcept(rhs.get(Row(0), Column(0))))
+{
+	static_assert(
+		LHSStorageType::COLUMNS == RHSStorageType::COLUMNS &&
+		LHSStorageType::ROWS == RHSStorageType::ROWS,
+		"Incompatible matrix sizes for addition"
+		);
+
+	if constexpr (detail::HaveSameDenseLayout<LHSStorageType, RHSStorageType>::VALUE) {
+		auto* lhsData = lhs.storage().data();
+		const auto* rhsData = rhs.storage().data();
+		for (auto index = size_t(0); index < LHSStorageType::STORED_ELEMENTS; ++index) {
+			lhsData[index] += rhsData[index];
+		}
+	} else {
+		for (auto rowIdx = Row(0); rowIdx.value() < LHSStorageType::ROWS; ++rowIdx) {
+			for (auto columnIdx = Column(0); columnIdx.value() < LHSStorageType::COLUMNS; ++columnIdx) {
+				lhs.set(rowIdx, columnIdx, lhs.get(rowIdx, columnIdx) + rhs.get(rowIdx, columnIdx));
+			}
+		}
+	}
+
+	return lhs;
+}
+
+template <class LHSStorageType, class RHSStorageType>
+inline auto& operator-=(
+	Matrix<LHSStorageType>& lhs,
+	const Matrix<RHSStorageType>& rhs
+	) noexcept(noexcept(lhs.get(Row(0), Column(0))) && noexcept(rhs.get(Row(0), Column(0))))
+{
+	static_assert(
+		LHSStorageType::COLUMNS == RHSStorageType::COLUMNS &&
+		LHSStorageType::ROWS == RHSStorageType::ROWS,
+		"Incompatible matrix sizes for subtraction"
+		);
+
+	if constexpr (detail::HaveSameDenseLayout<LHSStorageType, RHSStorageType>::VALUE) {
+		auto* lhsData = lhs.storage().data();
+		const auto* rhsData = rhs.storage().data();
+		for (auto index = size_t(0); index < LHSStorageType::STORED_ELEMENTS; ++index) {
+			lhsData[index] -= rhsData[index];
+		}
+	} else {
+		for (auto rowIdx = Row(0); rowIdx.value() < LHSStorageType::ROWS; ++rowIdx) {
+			for (auto columnIdx = Column(0); columnIdx.value() < LHSStorageType::COLUMNS; ++columnIdx) {
+				lhs.set(rowIdx, columnIdx, lhs.get(rowIdx, columnIdx) - rhs.get(rowIdx, columnIdx));
+			}
+		}
+	}
+
+	return lhs;
+}
+
+template <class LHSStorageType, class RHSStorageType>
+[[nodiscard]] inline auto operator+(
+	const Matrix<LHSStorageType>& lhs,
+	const Matrix<RHSStorageType>& rhs
+	) noexcept(noexcept(lhs.get(Row(0), Column(0))) && noexcept(rhs.get(Row(0), Column(0))))
+{
+	static_assert(
+		LHSStorageType::COLUMNS == RHSStorageType::COLUMNS &&
+		LHSStorageType::ROWS == RHSStorageType::ROWS,
+		"Incompatible matrix sizes for addition"
+		);
+	using ResultStorageType = ElementWiseResultType<LHSStorageType, RHSStorageType>;
+
+	auto result = Matrix<ResultStorageType>();
+
+	if constexpr (
+		detail::HaveSameDenseLayout<LHSStorageType, RHSStorageType>::VALUE &&
+		detail::HaveSameDenseLayout<ResultStorageType, LHSStorageType>::VALUE
+		)
+	{
+		auto* resultData = result.storage().data();
+		const auto* lhsData = lhs.storage().data();
+		const auto* rhsData = rhs.storage().data();
+		for (auto index = size_t(0); index < LHSStorageType::STORED_ELEMENTS; ++index) {
+			resultData[index] = lhsData[index] + rhsData[index];
+		}
+	} else {
+		for (auto rowIdx = Row(0); rowIdx.value() < LHSStorageType::ROWS; ++rowIdx) {
+			for (auto columnIdx = Column(0); columnIdx.value() < LHSStorageType::COLUMNS; ++columnIdx) {
+				result.set(rowIdx, columnIdx, lhs.get(rowIdx, columnIdx) + rhs.get(rowIdx, columnIdx));
+			}
+		}
+	}
+
+	return result;
+}
+
+template <class LHSStorageType, class RHSStorageType>
+[[nodiscard]] inline auto operator-(
+	const Matrix<LHSStorageType>& lhs,
+	const Matrix<RHSStorageType>& rhs
+	) noexcept(noexcept(lhs.get(Row(0), Column(0))) && noexcept(rhs.get(Row(0), Column(0))))
+{
+	static_assert(
+		LHSStorageType::COLUMNS == RHSStorageType::COLUMNS &&
+		LHSStorageType::ROWS == RHSStorageType::ROWS,
+		"Incompatible matrix sizes for subtraction"
+		);
+	using ResultStorageType = ElementWiseResultType<LHSStorageType, RHSStorageType>;
+
+	auto result = Matrix<ResultStorageType>();
+
+	if constexpr (
+		detail::HaveSameDenseLayout<LHSStorageType, RHSStorageType>::VALUE &&
+		detail::HaveSameDenseLayout<ResultStorageType, LHSStorageType>::VALUE
+		)
+	{
+		auto* resultData = result.storage().data();
+		const auto* lhsData = lhs.storage().data();
+		const auto* rhsData = rhs.storage().data();
+		for (auto index = size_t(0); index < LHSStorageType::STORED_ELEMENTS; ++index) {
+			resultData[index] = lhsData[index] - rhsData[index];
+		}
+	} else {
+		for (auto rowIdx = Row(0); rowIdx.value() < LHSStorageType::ROWS; ++rowIdx) {
+			for (auto columnIdx = Column(0); columnIdx.value() < LHSStorageType::COLUMNS; ++columnIdx) {
+				result.set(rowIdx, columnIdx, lhs.get(rowIdx, columnIdx) - rhs.get(rowIdx, columnIdx));
+			}
+		}
+	}
+
+	return result;
+}
+
+template <class StorageType>
+[[nodiscard]] inline auto operator-(const Matrix<StorageType>& matrix) noexcept(
+	noexcept(matrix.get(Row(0), Column(0))))
+{
+	using ResultStorageType = ElementWiseResultType<StorageType, StorageType>;
+
+	auto result = Matrix<ResultStorageType>();
+
+	if constexpr (detail::HaveSameDenseLayout<ResultStorageType, StorageType>::VALUE) {
+		auto* resultData = result.storage().data();
+		const auto* matrixData = matrix.storage().data();
+		for (auto index = size_t(0); index < StorageType::STORED_ELEMENTS; ++index) {
+			resultData[index] = -matrixData[index];
+		}
+	} else {
+		for (auto rowIdx = Row(0); rowIdx.value() < StorageType::ROWS; ++rowIdx) {
+			for (auto columnIdx = Column(0); columnIdx.value() < StorageType::COLUMNS; ++columnIdx) {
+				result.set(rowIdx, columnIdx, -matrix.get(rowIdx, columnIdx));
+			}
+		}
+	}
+
+	return result;
+}
+
 template <class StorageType>
 inline Matrix<StorageType>& operator*=(Matrix<StorageType>& matrix, typename StorageType::Scalar scalar) noexcept(
 	noexcept(matrix.get(Row(0), Column(0))))
 {
-	for (auto rowIdx = Row(0); rowIdx.value() < StorageType::ROWS; ++rowIdx) {
-		for (auto columnIdx = Column(0); columnIdx.value() < StorageType::COLUMNS; ++columnIdx) {
-			matrix.set(rowIdx, columnIdx, matrix.get(rowIdx, columnIdx) * scalar);
+	if constexpr (detail::HasDenseLayout<StorageType>::VALUE) {
+		auto* matrixData = matrix.storage().data();
+		for (auto index = size_t(0); index < StorageType::STORED_ELEMENTS; ++index) {
+			matrixData[index] *= scalar;
+		}
+	} else {
+		for (auto rowIdx = Row(0); rowIdx.value() < StorageType::ROWS; ++rowIdx) {
+			for (auto columnIdx = Column(0); columnIdx.value() < StorageType::COLUMNS; ++columnIdx) {
+				matrix.set(rowIdx, columnIdx, matrix.get(rowIdx, columnIdx) * scalar);
+			}
 		}
 	}
 
@@ -134,7 +547,7 @@ inline Matrix<StorageType>& operator*=(Matrix<StorageType>& matrix, typename Sto
 }
 
 template <class StorageType>
-inline [[nodiscard]] Matrix<StorageType> operator*(const Matrix<StorageType>& matrix, typename StorageType::Scalar scalar)
+[[nodiscard]] inline Matrix<StorageType> operator*(const Matrix<StorageType>& matrix, typename StorageType::Scalar scalar)
 	noexcept(noexcept(std::declval<Matrix<StorageType>&>() *= scalar))
 {
 	auto result = matrix;
@@ -143,7 +556,7 @@ inline [[nodiscard]] Matrix<StorageType> operator*(const Matrix<StorageType>& ma
 }
 
 template <class StorageType>
-inline [[nodiscard]] Matrix<StorageType> operator*(typename StorageType::Scalar scalar, const Matrix<StorageType>& matrix)
+[[nodiscard]] inline Matrix<StorageType> operator*(typename StorageType::Scalar scalar, const Matrix<StorageType>& matrix)
 	noexcept(noexcept(std::declval<Matrix<StorageType>&>() *= scalar))
 {
 	auto result = matrix;
@@ -151,13 +564,25 @@ inline [[nodiscard]] Matrix<StorageType> operator*(typename StorageType::Scalar
 	return result;
 }
 
+// Floating point matrices are multiplied by the reciprocal, trading a division per element for one in total.
 template <class StorageType>
 inline Matrix<StorageType>& operator/=(Matrix<StorageType>& matrix, typename StorageType::Scalar scalar) noexcept(
 	noexcept(matrix.get(Row(0), Column(0))))
 {
-	for (auto rowIdx = Row(0); rowIdx.value() < StorageType::ROWS; ++rowIdx) {
-		for (auto columnIdx = Column(0); columnIdx.value() < StorageType::COLUMNS; ++columnIdx) {
-			matrix.set(rowIdx, columnIdx, matrix.get(rowIdx, columnIdx) / scalar);
+	using Scalar = typename StorageType::Scalar;
+
+	if constexpr (std::is_floating_point_v<Scalar>) {
+		matrix *= Scalar(1) / scalar;
+	} else if constexpr (detail::HasDenseLayout<StorageType>::VALUE) {
+		auto* matrixData = matrix.storage().data();
+		for (auto index = size_t(0); index < StorageType::STORED_ELEMENTS; ++index) {
+			matrixData[index] /= scalar;
+		}
+	} else {
+		for (auto rowIdx = Row(0); rowIdx.value() < StorageType::ROWS; ++rowIdx) {
+			for (auto columnIdx = Column(0); columnIdx.value() < StorageType::COLUMNS; ++columnIdx) {
+				matrix.set(rowIdx, columnIdx, matrix.get(rowIdx, columnIdx) / scalar);
+			}
 		}
 	}
 
@@ -165,7 +590,7 @@ inline Matrix<StorageType>& operator/=(Matrix<StorageType>& matrix, typename Sto
 }
 
 template <class StorageType>
-inline [[nodiscard]] Matrix<StorageType> operator/(const Matrix<StorageType>& matrix, typename StorageType::Scalar scalar)
+[[nodiscard]] inline Matrix<StorageType> operator/(const Matrix<StorageType>& matrix, typename StorageType::Scalar scalar)
 	noexcept(noexcept(std::declval<Matrix<StorageType>&>() /= scalar))
 {
 	auto result = matrix;
@@ -174,7 +599,7 @@ inline [[nodiscard]] Matrix<StorageType> operator/(const Matrix<StorageType>& ma
 }
 
 template <class StorageType>
-inline [[nodiscard]] Matrix<StorageType> operator/(typename StorageType::Scalar scalar, const Matrix<StorageType>& matrix)
+[[nodiscard]] inline Matrix<StorageType> operator/(typename StorageType::Scalar scalar, const Matrix<StorageType>& matrix)
 	noexcept(noexcept(std::declval<Matrix<StorageType>&>() /= scalar))
 {
 	auto result = matrix;
@@ -211,26 +636,366 @@ inline std::ostream& operator<<(std::ostream& os, const Matrix<StorageType>& mat
 
 // -- free functions
 
+// Storages whose transposed storage reads the same array with swapped strides (see TransposedStorageType) are
+// transposed by copying the array as it is, others through a transposed view.
 template <class StorageType>
-inline [[nodiscard]] auto transposed(const Matrix<StorageType>& matrix) noexcept {
-	return Matrix<TransposedStorageType<StorageType>>(viewTransposed(matrix));
+[[nodiscard]] inline auto transposed(const Matrix<StorageType>& matrix) noexcept {
+	using ResultStorageType = TransposedStorageType<StorageType>;
+
+	auto result = Matrix<ResultStorageType>();
+
+	if constexpr (detail::HaveTransposedDenseLayout<ResultStorageType, StorageType>::VALUE) {
+		auto* resultData = result.storage().data();
+		const auto* data = matrix.storage().data();
+		for (auto index = size_t(0); index < StorageType::STORED_ELEMENTS; ++index) {
+			resultData[index] = data[index];
+		}
+	} else {
+		result = viewTransposed(matrix);
+	}
+
+	return result;
 }
 
 template <class ViewedMatrixType>
-inline [[nodiscard]] const auto& transposed(
+[[nodiscard]] inline const auto& transposed(
 	const Matrix<TransposedViewStorage<ViewedMatrixType>>& transposedMatrixView
 	) noexcept
 {
 	return transposedMatrixView.storage().viewedMatrix();
 }
 
+namespace detail {
+
+// The 2x2 minors of a 4x4 matrix formed from its top two rows (s) and its bottom two rows (c). Each minor of
+// the top rows pairs with the complementary one of the bottom rows in the Laplace expansion of the determinant
+// and all of them are reused by the cofactors of the inverse.
+template <class ScalarType>
+struct Minors4x4 {
+	ScalarType s0;
+	ScalarType s1;
+	ScalarType s2;
+	ScalarType s3;
+	ScalarType s4;
+	ScalarType s5;
+	ScalarType c0;
+	ScalarType c1;
+	ScalarType c2;
+	ScalarType c3;
+	ScalarType c4;
+	ScalarType c5;
+
+	ScalarType determinant() const noexcept {
+		return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+	}
+};
+
+template <class StorageType>
+auto minors4x4(const Matrix<StorageType>& matrix) noexcept {
+	using Scalar = typename StorageType::Scalar;
+
+	const auto a00 = matrix.get(Row(0), Column(0));
+	const auto a01 = matrix.get(Row(0), Column(1));
+	const auto a02 = matrix.get(Row(0), Column(2));
+	const auto a03 = matrix.get(Row(0), Column(3));
+	const auto a10 = matrix.get(Row(1), Column(0));
+	const auto a11 = matrix.get(Row(1), Column(1));
+	const auto a12 = matrix.get(Row(1), Column(2));
+	const auto a13 = matrix.get(Row(1), Column(3));
+	const auto a20 = matrix.get(Row(2), Column(0));
+	const auto a21 = matrix.get(Row(2), Column(1));
+	const auto a22 = matrix.get(Row(2), Column(2));
+	const auto a23 = matrix.get(Row(2), Column(3));
+	const auto a30 = matrix.get(Row(3), Column(0));
+	const auto a31 = matrix.get(Row(3), Column(1));
+	const auto a32 = matrix.get(Row(3), Column(2));
+	const auto a33 = matrix.get(Row(3), Column(3));
+
+	return Minors4x4<Scalar>{
+		a00 * a11 - a10 * a01,
+		a00 * a12 - a10 * a02,
+		a00 * a13 - a10 * a03,
+		a01 * a12 - a11 * a02,
+		a01 * a13 - a11 * a03,
+		a02 * a13 - a12 * a03,
+		a20 * a31 - a30 * a21,
+		a20 * a32 - a30 * a22,
+		a20 * a33 - a30 * a23,
+		a21 * a32 - a31 * a22,
+		a21 * a33 - a31 * a23,
+		a22 * a33 - a32 * a23
+	};
+}
+
+using BareissWide = std::intmax_t;
+
+inline bool checkedMultiply(BareissWide lhs, BareissWide rhs, BareissWide& result) noexcept {
+#if defined(__GNUC__)
+	return !__builtin_mul_overflow(lhs, rhs, &result);
+#else
+	constexpr auto MAX = std::numeric_limits<BareissWide>::max();
+	constexpr auto MIN = std::numeric_limits<BareissWide>::min();
+	const auto overflows = lhs > 0 ?
+		(rhs > 0 ? lhs > MAX / rhs : rhs < MIN / lhs) :
+		(rhs > 0 ? lhs < MIN / rhs : lhs != 0 && rhs < MAX / lhs);
+	if (overflows) {
+		return false;
+	}
+	result = lhs * rhs;
+	return true;
+#endif
+}
+
+inline bool checkedAdd(BareissWide lhs, BareissWide rhs, BareissWide& result) noexcept {
+#if defined(__GNUC__)
+	return !__builtin_add_overflow(lhs, rhs, &result);
+#else
+	constexpr auto MAX = std::numeric_limits<BareissWide>::max();
+	constexpr auto MIN = std::numeric_limits<BareissWide>::min();
+	if (rhs > 0 ? lhs > MAX - rhs : lhs < MIN - rhs) {
+		return false;
+	}
+	result = lhs + rhs;
+	return true;
+#endif
+}
+
+inline bool checkedSubtract(BareissWide lhs, BareissWide rhs, BareissWide& result) noexcept {
+#if defined(__GNUC__)
+	return !__builtin_sub_overflow(lhs, rhs, &result);
+#else
+	constexpr auto MAX = std::numeric_limits<BareissWide>::max();
+	constexpr auto MIN = std::numeric_limits<BareissWide>::min();
+	if (rhs > 0 ? lhs < MIN + rhs : lhs > MAX + rhs) {
+		return false;
+	}
+	result = lhs - rhs;
+	return true;
+#endif
+}
+
+// Replaces element with (element * pivot - factor * pivotRowElement) / previousPivot. The quotient is a minor of
+// the matrix, but the products are two minors multiplied together and can overflow even when the determinant
+// fits. They are formed in __int128 where the compiler has it, and with overflow checks otherwise. Returns false
+// if the update cannot be done exactly.
+inline bool bareissUpdate(
+	BareissWide& element, BareissWide pivot, BareissWide factor, BareissWide pivotRowElement, BareissWide previousPivot
+	) noexcept {
+#if defined(__SIZEOF_INT128__)
+	__extension__ using Product = __int128;
+	const auto quotient = (Product(element) * pivot - Product(factor) * pivotRowElement) / previousPivot;
+	if (quotient < Product(std::numeric_limits<BareissWide>::min()) ||
+		quotient > Product(std::numeric_limits<BareissWide>::max())) {
+		return false;
+	}
+	element = static_cast<BareissWide>(quotient);
+	return true;
+#else
+	auto lhs = BareissWide();
+	auto rhs = BareissWide();
+	auto difference = BareissWide();
+	if (!checkedMultiply(element, pivot, lhs) || !checkedMultiply(factor, pivotRowElement, rhs) ||
+		!checkedSubtract(lhs, rhs, difference)) {
+		return false;
+	}
+	element = difference / previousPivot;
+	return true;
+#endif
+}
+
+template <size_t SIZE, bool EXPAND_ON_OVERFLOW>
+std::optional<BareissWide> bareissDeterminant(std::array<BareissWide, SIZE * SIZE> elements) noexcept;
+
+// Expands along the first row, computing each minor by Bareiss elimination. Used when elimination on the whole
+// matrix overflows, since the minors need smaller intermediate products. The minors don't expand again, so this
+// is O(n^4).
+template <size_t SIZE>
+std::optional<BareissWide> expandedDeterminant(const std::array<BareissWide, SIZE * SIZE>& elements) noexcept {
+	auto result = BareissWide(0);
+	for (auto expandedColumnIdx = size_t(0); expandedColumnIdx < SIZE; ++expandedColumnIdx) {
+		if (elements[expandedColumnIdx] == BareissWide(0)) {
+			continue;
+		}
+
+		auto minorElements = std::array<BareissWide, (SIZE - 1) * (SIZE - 1)>();
+		auto minorIdx = size_t(0);
+		for (auto rowIdx = size_t(1); rowIdx < SIZE; ++rowIdx) {
+			for (auto columnIdx = size_t(0); columnIdx < SIZE; ++columnIdx) {
+				if (columnIdx != expandedColumnIdx) {
+					minorElements[minorIdx++] = elements[rowIdx * SIZE + columnIdx];
+				}
+			}
+		}
+
+		const auto minor = bareissDeterminant<SIZE - 1, false>(minorElements);
+		auto term = BareissWide();
+		if (!minor || !checkedMultiply(elements[expandedColumnIdx], *minor, term)) {
+			return std::nullopt;
+		}
+
+		const auto accumulated = (expandedColumnIdx % 2 == 0) ?
+			checkedAdd(result, term, result) :
+			checkedSubtract(result, term, result);
+		if (!accumulated) {
+			return std::nullopt;
+		}
+	}
+	return result;
+}
+
+// Fraction-free Gaussian elimination (Bareiss). Each step divides by the previous pivot, which divides every
+// updated element exactly, so integral determinants are computed exactly in O(n^3). The updated elements are
+// minors of the matrix and are kept in std::intmax_t; see bareissUpdate for the products between them. If an
+// update overflows anyway, the determinant is expanded along the first row once if EXPAND_ON_OVERFLOW is set.
+// Returns std::nullopt if the determinant or the minors it is computed from do not fit std::intmax_t.
+template <size_t SIZE, bool EXPAND_ON_OVERFLOW>
+std::optional<BareissWide> bareissDeterminant(std::array<BareissWide, SIZE * SIZE> elements) noexcept {
+	if constexpr (SIZE == 1) {
+		return elements[0];
+	} else {
+		const auto original = elements;
+		auto negate = false;
+		auto previousPivot = BareissWide(1);
+
+		for (auto pivotIdx = size_t(0); pivotIdx + 1 < SIZE; ++pivotIdx) {
+			if (elements[pivotIdx * SIZE + pivotIdx] == BareissWide(0)) {
+				auto swapRowIdx = pivotIdx + 1;
+				while (swapRowIdx < SIZE && elements[swapRowIdx * SIZE + pivotIdx] == BareissWide(0)) {
+					++swapRowIdx;
+				}
+
+				if (swapRowIdx == SIZE) {
+					return BareissWide(0);
+				}
+
+				for (auto columnIdx = pivotIdx; columnIdx < SIZE; ++columnIdx) {
+					std::swap(elements[pivotIdx * SIZE + columnIdx], elements[swapRowIdx * SIZE + columnIdx]);
+				}
+				negate = !negate;
+			}
+
+			const auto pivot = elements[pivotIdx * SIZE + pivotIdx];
+			for (auto rowIdx = pivotIdx + 1; rowIdx < SIZE; ++rowIdx) {
+				const auto factor = elements[rowIdx * SIZE + pivotIdx];
+				for (auto columnIdx = pivotIdx + 1; columnIdx < SIZE; ++columnIdx) {
+					if (!bareissUpdate(
+						elements[rowIdx * SIZE + columnIdx],
+						pivot,
+						factor,
+						elements[pivotIdx * SIZE + columnIdx],
+						previousPivot
+						)) {
+						if constexpr (EXPAND_ON_OVERFLOW) {
+							return expandedDeterminant<SIZE>(original);
+						} else {
+							return std::nullopt;
+						}
+					}
+				}
+			}
+
+			previousPivot = pivot;
+		}
+
+		auto result = elements[SIZE * SIZE - 1];
+		if (negate && !checkedSubtract(BareissWide(0), result, result)) {
+			return std::nullopt;
+		}
+		return result;
+	}
+}
+
+template <class Scalar>
+constexpr bool fitsScalar(BareissWide value) noexcept {
+	if constexpr (std::is_signed_v<Scalar>) {
+		return value >= BareissWide(std::numeric_limits<Scalar>::min()) &&
+			value <= BareissWide(std::numeric_limits<Scalar>::max());
+	} else if constexpr (sizeof(Scalar) < sizeof(BareissWide)) {
+		return value >= BareissWide(0) && value <= BareissWide(std::numeric_limits<Scalar>::max());
+	} else {
+		return value >= BareissWide(0);
+	}
+}
+
+// Determinants that don't fit Scalar are reported through the error handler.
 template <class StorageType>
-inline auto determinant(const Matrix<StorageType>& matrix) noexcept {
+auto bareissDeterminant(const Matrix<StorageType>& matrix) noexcept(
+	noexcept(StorageType::ErrorHandler::template overflow<typename StorageType::Scalar>()))
+{
+	using Scalar = typename StorageType::Scalar;
+	using ErrorHandler = typename StorageType::ErrorHandler;
+	constexpr auto SIZE = StorageType::ROWS;
+
+	auto elements = std::array<BareissWide, SIZE * SIZE>();
+	for (auto rowIdx = size_t(0); rowIdx < SIZE; ++rowIdx) {
+		for (auto columnIdx = size_t(0); columnIdx < SIZE; ++columnIdx) {
+			elements[rowIdx * SIZE + columnIdx] = static_cast<BareissWide>(matrix.get(Row(rowIdx), Column(columnIdx)));
+		}
+	}
+
+	const auto result = bareissDeterminant<SIZE, true>(elements);
+	if (!result || !fitsScalar<Scalar>(*result)) {
+		return ErrorHandler::template overflow<Scalar>();
+	}
+
+	return static_cast<Scalar>(*result);
+}
+
+// Integral determinants above 4x4 report overflow through the error handler, so they are noexcept if it is.
+template <class StorageType, class = void>
+struct IsDeterminantNoexcept {
+	enum { VALUE = true };
+};
+
+template <class StorageType>
+struct IsDeterminantNoexcept<
+	StorageType,
+	std::enable_if_t<std::is_integral_v<typename StorageType::Scalar> && (StorageType::ROWS > 4)>
+	>
+{
+	enum { VALUE = noexcept(StorageType::ErrorHandler::template overflow<typename StorageType::Scalar>()) };
+};
+
+} // namespace detail
+
+// Matrices up to 4x4 use closed forms. Larger floating point ones go through an LU decomposition and larger
+// integral ones through exact Bareiss elimination. Any other larger ones expand along the first row down to
+// the closed forms.
+template <class StorageType>
+inline auto determinant(const Matrix<StorageType>& matrix) noexcept(
+	detail::IsDeterminantNoexcept<StorageType>::VALUE)
+{
 	using MatrixType = Matrix<StorageType>;
+	using Scalar = typename MatrixType::Scalar;
 	static_assert(MatrixType::ROWS == MatrixType::COLUMNS, "Determinant only defined for square matrices");
 
-	if constexpr (MatrixType::ROWS > 1) {
-		auto result = MatrixType::Scalar(0);
+	if constexpr (MatrixType::ROWS == 1) {
+		return Scalar(matrix.get(Row(0), Column(0)));
+	} else if constexpr (MatrixType::ROWS == 2) {
+		return Scalar(
+			matrix.get(Row(0), Column(0)) * matrix.get(Row(1), Column(1)) -
+			matrix.get(Row(0), Column(1)) * matrix.get(Row(1), Column(0))
+			);
+	} else if constexpr (MatrixType::ROWS == 3) {
+		const auto a00 = matrix.get(Row(0), Column(0));
+		const auto a01 = matrix.get(Row(0), Column(1));
+		const auto a02 = matrix.get(Row(0), Column(2));
+		const auto a10 = matrix.get(Row(1), Column(0));
+		const auto a11 = matrix.get(Row(1), Column(1));
+		const auto a12 = matrix.get(Row(1), Column(2));
+		const auto a20 = matrix.get(Row(2), Column(0));
+		const auto a21 = matrix.get(Row(2), Column(1));
+		const auto a22 = matrix.get(Row(2), Column(2));
+
+		return Scalar(a00 * (a11 * a22 - a12 * a21) + a01 * (a12 * a20 - a10 * a22) + a02 * (a10 * a21 - a11 * a20));
+	} else if constexpr (MatrixType::ROWS == 4) {
+		return detail::minors4x4(matrix).determinant();
+	} else if constexpr (std::is_floating_point_v<Scalar>) {
+		return LUDecomposition<StorageType>(matrix).determinant();
+	} else if constexpr (std::is_integral_v<Scalar>) {
+		return detail::bareissDeterminant(matrix);
+	} else {
+		auto result = Scalar(0);
 		for (auto columnIndex = Column(0); columnIndex.value() < MatrixType::COLUMNS; ++columnIndex) {
 			const auto absElement =
 				matrix.get(Row(0), columnIndex) * determinant(viewSubmatrix(matrix, Row(0), columnIndex));
@@ -241,41 +1006,253 @@ inline auto determinant(const Matrix<StorageType>& matrix) noexcept {
 			}
 		}
 		return result;
-	} else {
-		return matrix.get(Row(0), Column(0));
 	}
 }
 
 template <class StorageType>
-inline auto cofactor(const Matrix<StorageType>& matrix, Row rowIndex, Column columnIndex) noexcept {
+inline auto cofactor(const Matrix<StorageType>& matrix, Row rowIndex, Column columnIndex) noexcept(
+	noexcept(determinant(viewSubmatrix(matrix, rowIndex, columnIndex))))
+{
 	const auto det = determinant(viewSubmatrix(matrix, rowIndex, columnIndex));
 	return ((rowIndex.value() + columnIndex.value()) % 2 == 0) ? det : -det;
 }
 
+namespace detail {
+
+// Inverts | L t ; 0 1 | as | L^-1 -L^-1 t ; 0 1 |, with L^-1 the closed-form 3x3 adjugate over the determinant.
+template <class StorageType>
+std::optional<Matrix<StorageType>> affineInverse(const Matrix<StorageType>& matrix) noexcept {
+	using Scalar = typename StorageType::Scalar;
+
+	const auto l00 = matrix.get(Row(0), Column(0));
+	const auto l01 = matrix.get(Row(0), Column(1));
+	const auto l02 = matrix.get(Row(0), Column(2));
+	const auto l10 = matrix.get(Row(1), Column(0));
+	const auto l11 = matrix.get(Row(1), Column(1));
+	const auto l12 = matrix.get(Row(1), Column(2));
+	const auto l20 = matrix.get(Row(2), Column(0));
+	const auto l21 = matrix.get(Row(2), Column(1));
+	const auto l22 = matrix.get(Row(2), Column(2));
+
+	const auto cofactor00 = l11 * l22 - l12 * l21;
+	const auto cofactor01 = l12 * l20 - l10 * l22;
+	const auto cofactor02 = l10 * l21 - l11 * l20;
+
+	const auto det = l00 * cofactor00 + l01 * cofactor01 + l02 * cofactor02;
+
+	auto result = std::optional<Matrix<StorageType>>();
+
+	if (det != Scalar(0)) {
+		const auto detInverse = Scalar(1) / det;
+
+		const auto inverse00 = detInverse * cofactor00;
+		const auto inverse01 = detInverse * (l02 * l21 - l01 * l22);
+		const auto inverse02 = detInverse * (l01 * l12 - l02 * l11);
+		const auto inverse10 = detInverse * cofactor01;
+		const auto inverse11 = detInverse * (l00 * l22 - l02 * l20);
+		const auto inverse12 = detInverse * (l02 * l10 - l00 * l12);
+		const auto inverse20 = detInverse * cofactor02;
+		const auto inverse21 = detInverse * (l01 * l20 - l00 * l21);
+		const auto inverse22 = detInverse * (l00 * l11 - l01 * l10);
+
+		const auto t0 = matrix.get(Row(0), Column(3));
+		const auto t1 = matrix.get(Row(1), Column(3));
+		const auto t2 = matrix.get(Row(2), Column(3));
+
+		result = Matrix<StorageType>::IDENTITY;
+
+		result->set(Row(0), Column(0), inverse00);
+		result->set(Row(0), Column(1), inverse01);
+		result->set(Row(0), Column(2), inverse02);
+		result->set(Row(0), Column(3), -(inverse00 * t0 + inverse01 * t1 + inverse02 * t2));
+		result->set(Row(1), Column(0), inverse10);
+		result->set(Row(1), Column(1), inverse11);
+		result->set(Row(1), Column(2), inverse12);
+		result->set(Row(1), Column(3), -(inverse10 * t0 + inverse11 * t1 + inverse12 * t2));
+		result->set(Row(2), Column(0), inverse20);
+		result->set(Row(2), Column(1), inverse21);
+		result->set(Row(2), Column(2), inverse22);
+		result->set(Row(2), Column(3), -(inverse20 * t0 + inverse21 * t1 + inverse22 * t2));
+	}
+
+	return result;
+}
+
+// Inverts matrices up to 4x4 as the adjugate over the determinant, writing each cofactor out in closed form.
+// The 4x4 cofactors are built from the same twelve 2x2 minors as the determinant.
+template <class ResultType, class StorageType>
+std::optional<ResultType> smallInverse(const Matrix<StorageType>& matrix) noexcept {
+	using Scalar = typename StorageType::Scalar;
+
+	auto result = std::optional<ResultType>();
+
+	if constexpr (StorageType::ROWS == 2) {
+		const auto a00 = matrix.get(Row(0), Column(0));
+		const auto a01 = matrix.get(Row(0), Column(1));
+		const auto a10 = matrix.get(Row(1), Column(0));
+		const auto a11 = matrix.get(Row(1), Column(1));
+
+		const auto det = a00 * a11 - a01 * a10;
+
+		if (det != Scalar(0)) {
+			const auto detInverse = Scalar(1) / det;
+
+			result = ResultType();
+
+			result->set(Row(0), Column(0), detInverse * a11);
+			result->set(Row(0), Column(1), detInverse * -a01);
+			result->set(Row(1), Column(0), detInverse * -a10);
+			result->set(Row(1), Column(1), detInverse * a00);
+		}
+	} else if constexpr (StorageType::ROWS == 3) {
+		const auto a00 = matrix.get(Row(0), Column(0));
+		const auto a01 = matrix.get(Row(0), Column(1));
+		const auto a02 = matrix.get(Row(0), Column(2));
+		const auto a10 = matrix.get(Row(1), Column(0));
+		const auto a11 = matrix.get(Row(1), Column(1));
+		const auto a12 = matrix.get(Row(1), Column(2));
+		const auto a20 = matrix.get(Row(2), Column(0));
+		const auto a21 = matrix.get(Row(2), Column(1));
+		const auto a22 = matrix.get(Row(2), Column(2));
+
+		const auto cofactor00 = a11 * a22 - a12 * a21;
+		const auto cofactor01 = a12 * a20 - a10 * a22;
+		const auto cofactor02 = a10 * a21 - a11 * a20;
+
+		const auto det = a00 * cofactor00 + a01 * cofactor01 + a02 * cofactor02;
+
+		if (det != Scalar(0)) {
+			const auto detInverse = Scalar(1) / det;
+
+			result = ResultType();
+
+			result->set(Row(0), Column(0), detInverse * cofactor00);
+			result->set(Row(0), Column(1), detInverse * (a02 * a21 - a01 * a22));
+			result->set(Row(0), Column(2), detInverse * (a01 * a12 - a02 * a11));
+			result->set(Row(1), Column(0), detInverse * cofactor01);
+			result->set(Row(1), Column(1), detInverse * (a00 * a22 - a02 * a20));
+			result->set(Row(1), Column(2), detInverse * (a02 * a10 - a00 * a12));
+			result->set(Row(2), Column(0), detInverse * cofactor02);
+			result->set(Row(2), Column(1), detInverse * (a01 * a20 - a00 * a21));
+			result->set(Row(2), Column(2), detInverse * (a00 * a11 - a01 * a10));
+		}
+	} else {
+		static_assert(StorageType::ROWS == 4, "Closed-form inverse only defined up to 4x4 matrices");
+
+		const auto minors = minors4x4(matrix);
+		const auto det = minors.determinant();
+
+		if (det != Scalar(0)) {
+			const auto detInverse = Scalar(1) / det;
+
+			const auto a00 = matrix.get(Row(0), Column(0));
+			const auto a01 = matrix.get(Row(0), Column(1));
+			const auto a02 = matrix.get(Row(0), Column(2));
+			const auto a03 = matrix.get(Row(0), Column(3));
+			const auto a10 = matrix.get(Row(1), Column(0));
+			const auto a11 = matrix.get(Row(1), Column(1));
+			const auto a12 = matrix.get(Row(1), Column(2));
+			const auto a13 = matrix.get(Row(1), Column(3));
+			const auto a20 = matrix.get(Row(2), Column(0));
+			const auto a21 = matrix.get(Row(2), Column(1));
+			const auto a22 = matrix.get(Row(2), Column(2));
+			const auto a23 = matrix.get(Row(2), Column(3));
+			const auto a30 = matrix.get(Row(3), Column(0));
+			const auto a31 = matrix.get(Row(3), Column(1));
+			const auto a32 = matrix.get(Row(3), Column(2));
+			const auto a33 = matrix.get(Row(3), Column(3));
+
+			const auto [s0, s1, s2, s3, s4, s5, c0, c1, c2, c3, c4, c5] = minors;
+
+			result = ResultType();
+
+			result->set(Row(0), Column(0), detInverse * (a11 * c5 - a12 * c4 + a13 * c3));
+			result->set(Row(0), Column(1), detInverse * (-a01 * c5 + a02 * c4 - a03 * c3));
+			result->set(Row(0), Column(2), detInverse * (a31 * s5 - a32 * s4 + a33 * s3));
+			result->set(Row(0), Column(3), detInverse * (-a21 * s5 + a22 * s4 - a23 * s3));
+			result->set(Row(1), Column(0), detInverse * (-a10 * c5 + a12 * c2 - a13 * c1));
+			result->set(Row(1), Column(1), detInverse * (a00 * c5 - a02 * c2 + a03 * c1));
+			result->set(Row(1), Column(2), detInverse * (-a30 * s5 + a32 * s2 - a33 * s1));
+			result->set(Row(1), Column(3), detInverse * (a20 * s5 - a22 * s2 + a23 * s1));
+			result->set(Row(2), Column(0), detInverse * (a10 * c4 - a11 * c2 + a13 * c0));
+			result->set(Row(2), Column(1), detInverse * (-a00 * c4 + a01 * c2 - a03 * c0));
+			result->set(Row(2), Column(2), detInverse * (a30 * s4 - a31 * s2 + a33 * s0));
+			result->set(Row(2), Column(3), detInverse * (-a20 * s4 + a21 * s2 - a23 * s0));
+			result->set(Row(3), Column(0), detInverse * (-a10 * c3 + a11 * c1 - a12 * c0));
+			result->set(Row(3), Column(1), detInverse * (a00 * c3 - a01 * c1 + a02 * c0));
+			result->set(Row(3), Column(2), detInverse * (-a30 * s3 + a31 * s1 - a32 * s0));
+			result->set(Row(3), Column(3), detInverse * (a20 * s3 - a21 * s1 + a22 * s0));
+		}
+	}
+
+	return result;
+}
+
+} // namespace detail
+
 template <class StorageType>
 inline auto inverse(const Matrix<StorageType>& matrix) noexcept /* TODO: not really */ {
 	using MatrixType = Matrix<StorageType>;
 	using Scalar = typename MatrixType::Scalar;
 	static_assert(MatrixType::ROWS == MatrixType::COLUMNS, "Inverse only defined for square matrices");
 
-	auto result = std::optional<EffectiveStorageType<MatrixType>>(); // TODO: effective storage type may not work?
-	
-	const auto det = determinant(matrix);
+	if constexpr (detail::IsAffineTransformStorage<StorageType>::VALUE) {
+		return detail::affineInverse(matrix);
+	} else if constexpr (MatrixType::ROWS >= 2 && MatrixType::ROWS <= 4) {
+		return detail::smallInverse<EffectiveStorageType<MatrixType>>(matrix);
+	} else if constexpr (MatrixType::ROWS > 4 && std::is_floating_point_v<Scalar>) {
+		return LUDecomposition<StorageType>(matrix).inverse();
+	} else {
+		auto result = std::optional<EffectiveStorageType<MatrixType>>(); // TODO: effective storage type may not work?
 
-	if (det != Scalar(0)) {
-		const auto detInverse = Scalar(1) / det;
+		const auto det = determinant(matrix);
 
-		result = EffectiveStorageType<MatrixType>();
+		if (det != Scalar(0)) {
+			const auto detInverse = Scalar(1) / det;
 
-		for (auto rowIndex = Row(0); rowIndex.value() < MatrixType::ROWS; ++rowIndex) {
-			for (auto columnIndex = Column(0); columnIndex.value() < MatrixType::COLUMNS; ++columnIndex) {
-				result->set(
-					rowIndex,
-					columnIndex,
-					detInverse * cofactor(matrix, Row(columnIndex.value()), Column(rowIndex.value()))
-					);
+			result = EffectiveStorageType<MatrixType>();
+
+			for (auto rowIndex = Row(0); rowIndex.value() < MatrixType::ROWS; ++rowIndex) {
+				for (auto columnIndex = Column(0); columnIndex.value() < MatrixType::COLUMNS; ++columnIndex) {
+					result->set(
+						rowIndex,
+						columnIndex,
+						detInverse * cofactor(matrix, Row(columnIndex.value()), Column(rowIndex.value()))
+						);
+				}
 			}
 		}
+
+		return result;
+	}
+}
+
+// Inverts a rigid transform, a rotation followed by a translation, as | R^T -R^T t ; 0 1 |. The result is
+// only meaningful if the 3x3 linear part is orthonormal, which is not checked.
+template <class StorageType>
+[[nodiscard]] inline Matrix<StorageType> inverseRigid(const Matrix<StorageType>& matrix) noexcept(
+	noexcept(matrix.get(Row(0), Column(0))))
+{
+	static_assert(
+		detail::IsAffineTransformStorage<StorageType>::VALUE,
+		"Rigid inverse only defined for affine transform storages"
+		);
+
+	const auto t0 = matrix.get(Row(0), Column(3));
+	const auto t1 = matrix.get(Row(1), Column(3));
+	const auto t2 = matrix.get(Row(2), Column(3));
+
+	auto result = Matrix<StorageType>::IDENTITY;
+
+	for (auto rowIdx = Row(0); rowIdx.value() < 3; ++rowIdx) {
+		const auto r0 = matrix.get(Row(0), Column(rowIdx.value()));
+		const auto r1 = matrix.get(Row(1), Column(rowIdx.value()));
+		const auto r2 = matrix.get(Row(2), Column(rowIdx.value()));
+
+		result.set(rowIdx, Column(0), r0);
+		result.set(rowIdx, Column(1), r1);
+		result.set(rowIdx, Column(2), r2);
+		result.set(rowIdx, Column(3), -(r0 * t0 + r1 * t1 + r2 * t2));
 	}
 
 	return result;
@@ -31,8 +31,8 @@ public:
 
 	using StorageType::StorageType;
 
-	// Conversion from compatible matrix types
-	// TODO: this should probably be implemented in storage also (not in here)
+	// Conversion from compatible matrix types. Storages may implement it themselves (see detail::HasAssignFrom
+	// and detail::HasAssignTo), otherwise it copies between contiguous layouts or element by element.
 	template <class OtherStorageType>
 	explicit Matrix(const Matrix<OtherStorageType>& other) {
 		*this = other;
@@ -43,12 +43,55 @@ public:
 		static_assert(ROWS == Matrix<OtherStorageType>::ROWS);
 		static_assert(COLUMNS == Matrix<OtherStorageType>::COLUMNS);
 
-		for (auto rowIdx = Row(0); rowIdx.value() < ROWS; ++rowIdx) {
-			for (auto columnIdx = Column(0); columnIdx.value() < COLUMNS; ++columnIdx) {
-				set(rowIdx, columnIdx, other.get(rowIdx, columnIdx));
+		if constexpr (detail::HasAssignFrom<StorageType, OtherStorageType>::VALUE) {
+			StorageType::assignFrom(other.storage());
+		} else if constexpr (detail::HasAssignTo<OtherStorageType, StorageType>::VALUE) {
+			other.storage().assignTo(storage());
+		} else if constexpr (
+			detail::HasDenseLayout<StorageType>::VALUE &&
+			detail::HasDenseLayout<OtherStorageType>::VALUE
+			)
+		{
+			// Walks this matrix in memory order, reading the other one with its own strides.
+			constexpr auto ROW_MAJOR = (StorageType::MAJOR_ORDER == MajorOrder::ROW);
+			constexpr auto OUTER_SIZE = ROW_MAJOR ? ROWS : COLUMNS;
+			constexpr auto INNER_SIZE = ROW_MAJOR ? COLUMNS : ROWS;
+			constexpr auto OUTER_STRIDE = ROW_MAJOR ? OtherStorageType::ROW_STRIDE : OtherStorageType::COLUMN_STRIDE;
+			constexpr auto INNER_STRIDE = ROW_MAJOR ? OtherStorageType::COLUMN_STRIDE : OtherStorageType::ROW_STRIDE;
+
+			auto* data = storage().data();
+			const auto* otherData = other.storage().data();
+			for (auto outerIdx = size_t(0); outerIdx < OUTER_SIZE; ++outerIdx) {
+				for (auto innerIdx = size_t(0); innerIdx < INNER_SIZE; ++innerIdx) {
+					*data++ = static_cast<Scalar>(otherData[outerIdx * OUTER_STRIDE + innerIdx * INNER_STRIDE]);
+				}
+			}
+		} else {
+			for (auto rowIdx = Row(0); rowIdx.value() < ROWS; ++rowIdx) {
+				for (auto columnIdx = Column(0); columnIdx.value() < COLUMNS; ++columnIdx) {
+					set(rowIdx, columnIdx, other.get(rowIdx, columnIdx));
+				}
 			}
 		}
-		
+
+		return *this;
+	}
+
+	// Evaluation of lazy expressions (see MatrixExpression.hpp)
+	template <
+		class ExpressionType,
+		typename = std::enable_if_t<detail::IsMatrixExpression<ExpressionType>::VALUE>
+		>
+	Matrix(const ExpressionType& expression) {
+		expression.evaluateInto(*this);
+	}
+
+	template <
+		class ExpressionType,
+		typename = std::enable_if_t<detail::IsMatrixExpression<ExpressionType>::VALUE>
+		>
+	Matrix& operator=(const ExpressionType& expression) {
+		expression.evaluateInto(*this);
 		return *this;
 	}
 
@@ -68,11 +111,15 @@ public:
 
 	Matrix& transpose() noexcept {
 		static_assert(ROWS == COLUMNS, "Can't transpose self for non-square matrices");
-		for (auto rowIdx = Row(0); rowIdx.value() < ROWS; ++rowIdx) {
-			for (auto columnIdx = Column(0); columnIdx.value() < rowIdx.value(); ++columnIdx) {
-				auto stored = get(rowIdx, columnIdx);
-				set(rowIdx, columnIdx, get(Row(columnIdx.value()), Column(rowIdx.value())));
-				set(Row(columnIdx.value()), Column(rowIdx.value()), stored);
+		if constexpr (detail::HasTransposeInPlace<StorageType>::VALUE) {
+			StorageType::transposeInPlace();
+		} else {
+			for (auto rowIdx = Row(0); rowIdx.value() < ROWS; ++rowIdx) {
+				for (auto columnIdx = Column(0); columnIdx.value() < rowIdx.value(); ++columnIdx) {
+					auto stored = get(rowIdx, columnIdx);
+					set(rowIdx, columnIdx, get(Row(columnIdx.value()), Column(rowIdx.value())));
+					set(Row(columnIdx.value()), Column(rowIdx.value()), stored);
+				}
 			}
 		}
 
@@ -83,8 +130,35 @@ public:
 		return static_cast<const StorageType&>(*this);
 	}
 
+	Storage& storage() noexcept {
+		return static_cast<StorageType&>(*this);
+	}
+
 };
 
+namespace detail {
+
+// Applied by product kernels (scaledProduct) to every element or SIMD column of the result just before it is
+// stored, so that a scaled product is written in a single pass. operator* is the unscaled product.
+struct Unscaled {
+	template <class ValueType>
+	const ValueType& operator()(const ValueType& value) const noexcept {
+		return value;
+	}
+};
+
+template <class ScalarType>
+struct Scaled {
+	ScalarType factor;
+
+	template <class ValueType>
+	ValueType operator()(const ValueType& value) const noexcept {
+		return value * ValueType(factor);
+	}
+};
+
+} // namespace detail
+
 } // namespace caramel_math::matrix
 
 #endif /* CARAMELMATH_MATRIX_MATRIX_TEMPLATE_HPP__ */
@@ -0,0 +1,303 @@
+#ifndef CARAMELMATH_MATRIX_MATRIXEXPRESSION_HPP__
+#define CARAMELMATH_MATRIX_MATRIXEXPRESSION_HPP__
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "../setup.hpp"
+#include "matrix-coordinates.hpp"
+#include "Matrix.template.hpp"
+#include "ViewStorage.hpp"
+#include "storage-traits.hpp"
+
+// Opt-in lazy evaluation of matrix arithmetic. lazy(matrix) starts an expression; products with other
+// expressions or matrices, scaling by a scalar and transposition then build nodes instead of results. Converting
+// the expression to a Matrix evaluates it:
+//
+//     const auto mvp = Matrix<Storage>(lazy(projection) * view * model * 0.5f);
+//
+// Products are evaluated by the product kernels of the storages involved (see scaledProduct). Scalar factors are
+// hoisted to the outermost node and applied by the last product as it stores each element or column, so the
+// result is written once. Transposition is folded into transposed views of the referenced matrices. Nested
+// products are evaluated once each, as their elements are needed many times. Expressions only reference the
+// matrices they were built from, which must outlive them.
+
+namespace caramel_math::matrix {
+
+template <class MatrixType, bool TRANSPOSED>
+class MatrixReferenceExpression {
+public:
+
+	using ReferencedMatrix = MatrixType;
+
+	using Scalar = typename MatrixType::Scalar;
+
+	using ResultStorage = std::conditional_t<
+		TRANSPOSED,
+		TransposedStorageType<typename MatrixType::Storage>,
+		EffectiveStorageType<typename MatrixType::Storage>
+		>;
+
+	static constexpr auto ROWS = TRANSPOSED ? MatrixType::COLUMNS : MatrixType::ROWS;
+
+	static constexpr auto COLUMNS = TRANSPOSED ? MatrixType::ROWS : MatrixType::COLUMNS;
+
+	explicit MatrixReferenceExpression(const MatrixType& matrix, Scalar scale = Scalar(1)) noexcept :
+		matrix_(matrix),
+		scale_(scale)
+	{
+	}
+
+	// Yields the referenced element, without the scale.
+	Scalar get(Row row, Column column) const noexcept(noexcept(matrix_.get(row, column))) {
+		if constexpr (TRANSPOSED) {
+			return matrix_.get(Row(column.value()), Column(row.value()));
+		} else {
+			return matrix_.get(row, column);
+		}
+	}
+
+	const MatrixType& referencedMatrix() const noexcept {
+		return matrix_;
+	}
+
+	Scalar scale() const noexcept {
+		return scale_;
+	}
+
+	MatrixReferenceExpression scaled(Scalar factor) const noexcept {
+		return MatrixReferenceExpression(matrix_, scale_ * factor);
+	}
+
+	MatrixReferenceExpression unscaled() const noexcept {
+		return MatrixReferenceExpression(matrix_);
+	}
+
+	// Dense layouts matching the result, as they are or transposed, are scaled while they are copied. Other
+	// storages are copied or transposed by their own kernels and scaled in a second pass.
+	template <class ResultStorageType>
+	void evaluateInto(Matrix<ResultStorageType>& result) const {
+		static_assert(ResultStorageType::ROWS == ROWS && ResultStorageType::COLUMNS == COLUMNS);
+		using Storage = typename MatrixType::Storage;
+
+		constexpr auto DENSE_COPY = TRANSPOSED ?
+			bool(detail::HaveTransposedDenseLayout<ResultStorageType, Storage>::VALUE) :
+			bool(detail::HaveSameDenseLayout<ResultStorageType, Storage>::VALUE);
+
+		if constexpr (DENSE_COPY) {
+			auto* resultData = result.storage().data();
+			const auto* data = matrix_.storage().data();
+			for (auto index = size_t(0); index < ResultStorageType::STORED_ELEMENTS; ++index) {
+				resultData[index] = scale_ * data[index];
+			}
+		} else {
+			if constexpr (TRANSPOSED) {
+				result = transposed(matrix_);
+			} else {
+				result = matrix_;
+			}
+
+			if (scale_ != Scalar(1)) {
+				result *= scale_;
+			}
+		}
+	}
+
+private:
+
+	const MatrixType& matrix_;
+
+	Scalar scale_;
+
+};
+
+namespace detail {
+
+// Operands of products are passed to scaledProduct as the referenced matrix, its transposition or the evaluated
+// product. The operands are never scaled, as products take over their scales. Square matrices are transposed
+// through a view, which the kernels read without copying; views take the storage type of the viewed matrix, so
+// others are transposed into their transposed storage.
+template <class MatrixType>
+const auto& evaluatedOperand(const MatrixReferenceExpression<MatrixType, false>& operand) noexcept {
+	return operand.referencedMatrix();
+}
+
+template <class MatrixType>
+auto evaluatedOperand(const MatrixReferenceExpression<MatrixType, true>& operand) noexcept {
+	if constexpr (MatrixType::ROWS == MatrixType::COLUMNS) {
+		return viewTransposed(operand.referencedMatrix());
+	} else {
+		return transposed(operand.referencedMatrix());
+	}
+}
+
+template <class LHSExpressionType, class RHSExpressionType>
+auto evaluatedOperand(const MatrixProductExpression<LHSExpressionType, RHSExpressionType>& operand) {
+	using ResultStorage = typename MatrixProductExpression<LHSExpressionType, RHSExpressionType>::ResultStorage;
+	return Matrix<ResultStorage>(operand);
+}
+
+} // namespace detail
+
+template <class LHSExpressionType, class RHSExpressionType>
+class MatrixProductExpression {
+public:
+
+	using Scalar = typename LHSExpressionType::Scalar;
+
+	static constexpr auto ROWS = LHSExpressionType::ROWS;
+
+	static constexpr auto COLUMNS = RHSExpressionType::COLUMNS;
+
+	using ResultStorage = BinaryOperatorResultType<
+		typename LHSExpressionType::ResultStorage,
+		typename RHSExpressionType::ResultStorage,
+		ROWS,
+		COLUMNS
+		>;
+
+	static_assert(LHSExpressionType::COLUMNS == RHSExpressionType::ROWS, "Incompatible matrix sizes for multiplication");
+
+	MatrixProductExpression(LHSExpressionType lhs, RHSExpressionType rhs, Scalar scale) noexcept :
+		lhs_(std::move(lhs)),
+		rhs_(std::move(rhs)),
+		scale_(scale)
+	{
+	}
+
+	const LHSExpressionType& lhs() const noexcept {
+		return lhs_;
+	}
+
+	const RHSExpressionType& rhs() const noexcept {
+		return rhs_;
+	}
+
+	Scalar scale() const noexcept {
+		return scale_;
+	}
+
+	MatrixProductExpression scaled(Scalar factor) const noexcept {
+		return MatrixProductExpression(lhs_, rhs_, scale_ * factor);
+	}
+
+	MatrixProductExpression unscaled() const noexcept {
+		return MatrixProductExpression(lhs_, rhs_, Scalar(1));
+	}
+
+	// The product is complete before it is assigned, so result may be one of the operands.
+	template <class ResultStorageType>
+	void evaluateInto(Matrix<ResultStorageType>& result) const {
+		static_assert(ResultStorageType::ROWS == ROWS && ResultStorageType::COLUMNS == COLUMNS);
+
+		const auto& lhs = detail::evaluatedOperand(lhs_);
+		const auto& rhs = detail::evaluatedOperand(rhs_);
+
+		if (scale_ == Scalar(1)) {
+			result = scaledProduct(lhs, rhs, detail::Unscaled());
+		} else {
+			result = scaledProduct(lhs, rhs, detail::Scaled<Scalar>{ scale_ });
+		}
+	}
+
+private:
+
+	LHSExpressionType lhs_;
+
+	RHSExpressionType rhs_;
+
+	Scalar scale_;
+
+};
+
+template <class StorageType>
+[[nodiscard]] inline auto lazy(const Matrix<StorageType>& matrix) noexcept {
+	return MatrixReferenceExpression<Matrix<StorageType>, false>(matrix);
+}
+
+// Expressions reference the matrix, so temporaries are refused.
+template <class StorageType>
+void lazy(const Matrix<StorageType>&& matrix) = delete;
+
+namespace detail {
+
+template <class StorageType>
+auto asExpression(const Matrix<StorageType>& matrix) noexcept {
+	return lazy(matrix);
+}
+
+template <class ExpressionType>
+auto asExpression(const ExpressionType& expression) noexcept
+	-> std::enable_if_t<IsMatrixExpression<ExpressionType>::VALUE, const ExpressionType&>
+{
+	return expression;
+}
+
+} // namespace detail
+
+// Products of expressions with expressions or matrices. The scales of both operands move to the product.
+template <class LHSType, class RHSType>
+[[nodiscard]] inline auto operator*(const LHSType& lhs, const RHSType& rhs) noexcept -> std::enable_if_t<
+	(detail::IsMatrixExpression<LHSType>::VALUE || detail::IsMatrixExpression<RHSType>::VALUE) &&
+	(detail::IsMatrixExpression<LHSType>::VALUE || detail::IsMatrix<LHSType>::VALUE) &&
+	(detail::IsMatrixExpression<RHSType>::VALUE || detail::IsMatrix<RHSType>::VALUE),
+	MatrixProductExpression<
+		decltype(detail::asExpression(lhs).unscaled()),
+		decltype(detail::asExpression(rhs).unscaled())
+		>
+	>
+{
+	const auto& lhsExpression = detail::asExpression(lhs);
+	const auto& rhsExpression = detail::asExpression(rhs);
+
+	return {
+		lhsExpression.unscaled(),
+		rhsExpression.unscaled(),
+		lhsExpression.scale() * rhsExpression.scale()
+	};
+}
+
+// Expressions reference the matrices they are built from, so temporary matrices are refused as operands, like
+// in lazy(). Products of matrices and other temporaries have to be stored, or built lazily as well.
+template <class StorageType, class ExpressionType>
+auto operator*(const Matrix<StorageType>&& lhs, const ExpressionType& rhs)
+	-> std::enable_if_t<detail::IsMatrixExpression<ExpressionType>::VALUE> = delete;
+
+template <class ExpressionType, class StorageType>
+auto operator*(const ExpressionType& lhs, const Matrix<StorageType>&& rhs)
+	-> std::enable_if_t<detail::IsMatrixExpression<ExpressionType>::VALUE> = delete;
+
+template <class ExpressionType>
+[[nodiscard]] inline auto operator*(const ExpressionType& expression, typename ExpressionType::Scalar scalar) noexcept
+	-> std::enable_if_t<detail::IsMatrixExpression<ExpressionType>::VALUE, ExpressionType>
+{
+	return expression.scaled(scalar);
+}
+
+template <class ExpressionType>
+[[nodiscard]] inline auto operator*(typename ExpressionType::Scalar scalar, const ExpressionType& expression) noexcept
+	-> std::enable_if_t<detail::IsMatrixExpression<ExpressionType>::VALUE, ExpressionType>
+{
+	return expression.scaled(scalar);
+}
+
+template <class MatrixType, bool TRANSPOSED>
+[[nodiscard]] inline auto transposed(const MatrixReferenceExpression<MatrixType, TRANSPOSED>& expression) noexcept {
+	return MatrixReferenceExpression<MatrixType, !TRANSPOSED>(expression.referencedMatrix(), expression.scale());
+}
+
+// (A * B)^T is evaluated as B^T * A^T, transposing only the index order of the referenced matrices.
+template <class LHSExpressionType, class RHSExpressionType>
+[[nodiscard]] inline auto transposed(
+	const MatrixProductExpression<LHSExpressionType, RHSExpressionType>& expression
+	) noexcept
+{
+	auto lhs = transposed(expression.rhs());
+	auto rhs = transposed(expression.lhs());
+	return MatrixProductExpression<decltype(lhs), decltype(rhs)>(std::move(lhs), std::move(rhs), expression.scale());
+}
+
+} // namespace caramel_math::matrix
+
+#endif /* CARAMELMATH_MATRIX_MATRIXEXPRESSION_HPP__ */
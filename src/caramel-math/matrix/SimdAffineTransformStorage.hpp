@@ -0,0 +1,275 @@
+#ifndef CARAMELMATH_MATRIX_SIMDAFFINETRANSFORMSTORAGE_HPP__
+#define CARAMELMATH_MATRIX_SIMDAFFINETRANSFORMSTORAGE_HPP__
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+#include "../setup.hpp"
+#include "matrix-coordinates.hpp"
+#include "Matrix.template.hpp"
+#include "SimdStorage.hpp"
+
+namespace caramel_math::matrix {
+
+// Storage of a 4x4 affine transform matrix as its top three rows, each a simd::Float4 or simd::Double4.
+// The last row is implicitly { 0, 0, 0, 1 }, as in AffineTransformStorage.
+template <
+	class ScalarTraitsType,
+	class ErrorHandlerType
+	>
+class SimdAffineTransformStorage {
+public:
+
+	using ScalarTraits = ScalarTraitsType;
+
+	static_assert(
+		std::is_same_v<typename ScalarTraits::Scalar, float> || std::is_same_v<typename ScalarTraits::Scalar, double>,
+		"Non-float, non-double scalar type provided"
+		);
+
+	using ErrorHandler = ErrorHandlerType;
+
+	using Scalar = typename ScalarTraits::Scalar;
+
+	using GetReturnType = Scalar;
+
+	using RowType = typename detail::SimdColumnType<Scalar>::Type;
+
+	static constexpr auto ROWS = 4;
+
+	static constexpr auto COLUMNS = 4;
+
+	SimdAffineTransformStorage() = default;
+
+	explicit SimdAffineTransformStorage(
+		Scalar s00,
+		Scalar s01,
+		Scalar s02,
+		Scalar s03,
+		Scalar s10,
+		Scalar s11,
+		Scalar s12,
+		Scalar s13,
+		Scalar s20,
+		Scalar s21,
+		Scalar s22,
+		Scalar s23
+		) noexcept :
+		rows_{
+			RowType({ s00, s01, s02, s03 }),
+			RowType({ s10, s11, s12, s13 }),
+			RowType({ s20, s21, s22, s23 })
+		}
+	{
+	}
+
+	Scalar get(Row row, Column column) const noexcept(
+		noexcept(ErrorHandler::template invalidAccess<Scalar>(row, column)))
+	{
+		if constexpr (RUNTIME_CHECKS) {
+			if (row.value() >= ROWS || column.value() >= COLUMNS) {
+				return ErrorHandler::template invalidAccess<Scalar>(row, column);
+			}
+		}
+
+		if (row.value() == ROWS - 1) {
+			if (column.value() == COLUMNS - 1) {
+				return ScalarTraits::ONE;
+			} else {
+				return ScalarTraits::ZERO;
+			}
+		}
+
+		return detail::extractLane(rows_[row.value()], column.value());
+	}
+
+	void set(Row row, Column column, Scalar scalar) noexcept(
+		noexcept(ErrorHandler::template invalidAccess<Scalar>(row, column)))
+	{
+		if constexpr (RUNTIME_CHECKS) {
+			if (row.value() >= ROWS || column.value() >= COLUMNS) {
+				ErrorHandler::template invalidAccess<Scalar>(row, column);
+				return;
+			}
+		}
+
+		if (row.value() == ROWS - 1) {
+			if constexpr (RUNTIME_CHECKS) {
+				if (column.value() == COLUMNS - 1 && !ScalarTraits::equal(scalar, ScalarTraits::ONE)) {
+					ErrorHandler::invalidValue(row, column, scalar, ScalarTraits::ONE);
+				} else if (column.value() < COLUMNS - 1 && !ScalarTraits::equal(scalar, ScalarTraits::ZERO)) {
+					ErrorHandler::invalidValue(row, column, scalar, ScalarTraits::ZERO);
+				}
+			}
+
+			return;
+		}
+
+		rows_[row.value()] = detail::insertLane(rows_[row.value()], column.value(), scalar);
+	}
+
+	// Returns the whole row, { 0, 0, 0, 1 } for the last one. Invalid rows are reported at their first column.
+	RowType get(Row row) const noexcept(
+		noexcept(ErrorHandler::template invalidAccess<RowType>(row, Column(0))))
+	{
+		if constexpr (RUNTIME_CHECKS) {
+			if (row.value() >= ROWS) {
+				return ErrorHandler::template invalidAccess<RowType>(row, Column(0));
+			}
+		}
+
+		if (row.value() == ROWS - 1) {
+			return RowType({ ScalarTraits::ZERO, ScalarTraits::ZERO, ScalarTraits::ZERO, ScalarTraits::ONE });
+		}
+
+		return rows_[row.value()];
+	}
+
+	// Replaces one of the stored rows. The last row is not stored, so setting it is ignored; with runtime checks
+	// each lane that differs from { 0, 0, 0, 1 } is reported as an invalid value, like the scalar set.
+	void set(Row row, RowType value) noexcept(
+		noexcept(ErrorHandler::template invalidAccess<RowType>(row, Column(0))) &&
+		noexcept(ErrorHandler::invalidValue(row, Column(0), ScalarTraits::ZERO, ScalarTraits::ZERO)))
+	{
+		if constexpr (RUNTIME_CHECKS) {
+			if (row.value() >= ROWS) {
+				ErrorHandler::template invalidAccess<RowType>(row, Column(0));
+				return;
+			}
+		}
+
+		if (row.value() == ROWS - 1) {
+			if constexpr (RUNTIME_CHECKS) {
+				const auto lastRow =
+					RowType({ ScalarTraits::ZERO, ScalarTraits::ZERO, ScalarTraits::ZERO, ScalarTraits::ONE });
+				const auto equalLanes = movemask(cmpEq(value, lastRow));
+				for (auto column = Column(0); column.value() < COLUMNS; ++column) {
+					if ((equalLanes & (1 << column.value())) == 0) {
+						ErrorHandler::invalidValue(
+							row,
+							column,
+							detail::extractLane(value, column.value()),
+							detail::extractLane(lastRow, column.value())
+							);
+					}
+				}
+			}
+
+			return;
+		}
+
+		rows_[row.value()] = std::move(value);
+	}
+
+private:
+
+	std::array<RowType, ROWS - 1> rows_;
+
+};
+
+namespace detail {
+
+template <class ScalarTraitsType, class ErrorHandlerType>
+struct IsAffineTransformStorage<SimdAffineTransformStorage<ScalarTraitsType, ErrorHandlerType>> {
+	enum { VALUE = true };
+};
+
+// Computes row * | b0 ; b1 ; b2 ; 0 0 0 1 | for a row of an affine transform. The last row contributes only
+// the row's own translation, which translationMask selects, so this takes 12 multiplies instead of 16.
+template <class RowType, class MaskType>
+RowType multiplyAffineRow(
+	const RowType& row,
+	const RowType& b0,
+	const RowType& b1,
+	const RowType& b2,
+	const MaskType& translationMask
+	) noexcept
+{
+	auto result = select(translationMask, row, RowType(0));
+	result = madd(b0, row.template broadcastLane<0>(), result);
+	result = madd(b1, row.template broadcastLane<1>(), result);
+	result = madd(b2, row.template broadcastLane<2>(), result);
+
+	return result;
+}
+
+// Composes two affine transforms in 36 multiplies, never touching the implicit last row. Only the stored rows can
+// be scaled; as in set(), a scale that would change the last row is reported with runtime checks.
+template <
+	class LHSScalarTraitsType,
+	class LHSErrorHandlerType,
+	class RHSScalarTraitsType,
+	class RHSErrorHandlerType,
+	class ScaleType
+	>
+inline auto scaledProduct(
+	const Matrix<SimdAffineTransformStorage<LHSScalarTraitsType, LHSErrorHandlerType>>& lhs,
+	const Matrix<SimdAffineTransformStorage<RHSScalarTraitsType, RHSErrorHandlerType>>& rhs,
+	const ScaleType& scale
+	) noexcept(noexcept(lhs.get(Row(0))) && noexcept(rhs.get(Row(0))))
+{
+	using ResultType = Matrix<SimdAffineTransformStorage<LHSScalarTraitsType, LHSErrorHandlerType>>;
+	using RowType = typename ResultType::Storage::RowType;
+	using Scalar = typename ResultType::Scalar;
+
+	const auto translationMask = cmpEq(RowType({ Scalar(0), Scalar(0), Scalar(0), Scalar(1) }), RowType(Scalar(1)));
+
+	const auto rhsRow0 = rhs.get(Row(0));
+	const auto rhsRow1 = rhs.get(Row(1));
+	const auto rhsRow2 = rhs.get(Row(2));
+
+	auto result = ResultType();
+
+	for (auto rowIdx = Row(0); rowIdx.value() < 3; ++rowIdx) {
+		result.set(
+			rowIdx,
+			scale(multiplyAffineRow(lhs.get(rowIdx), rhsRow0, rhsRow1, rhsRow2, translationMask))
+			);
+	}
+
+	if constexpr (RUNTIME_CHECKS) {
+		result.set(Row(3), Column(3), scale(Scalar(1)));
+	}
+
+	return result;
+}
+
+// Multiplies an affine transform by a full 4x4 SimdStorage matrix. The affine rows are transposed into
+// columns once, after which the product is the SimdStorage one.
+template <
+	class LHSScalarTraitsType,
+	class LHSErrorHandlerType,
+	class RHSScalarTraitsType,
+	class RHSErrorHandlerType,
+	class ScaleType
+	>
+inline auto scaledProduct(
+	const Matrix<SimdAffineTransformStorage<LHSScalarTraitsType, LHSErrorHandlerType>>& lhs,
+	const Matrix<SimdStorage<RHSScalarTraitsType, RHSErrorHandlerType>>& rhs,
+	const ScaleType& scale
+	) noexcept(noexcept(lhs.get(Row(0))) && noexcept(rhs.get(Column(0))))
+{
+	auto lhsColumn0 = lhs.get(Row(0));
+	auto lhsColumn1 = lhs.get(Row(1));
+	auto lhsColumn2 = lhs.get(Row(2));
+	auto lhsColumn3 = lhs.get(Row(3));
+	transpose(lhsColumn0, lhsColumn1, lhsColumn2, lhsColumn3);
+
+	auto result = Matrix<SimdStorage<RHSScalarTraitsType, RHSErrorHandlerType>>();
+
+	for (auto columnIdx = Column(0); columnIdx.value() < 4; ++columnIdx) {
+		result.set(
+			columnIdx,
+			scale(combineColumns(lhsColumn0, lhsColumn1, lhsColumn2, lhsColumn3, rhs.get(columnIdx)))
+			);
+	}
+
+	return result;
+}
+
+} // namespace detail
+
+} // namespace caramel_math::matrix
+
+#endif /* CARAMELMATH_MATRIX_SIMDAFFINETRANSFORMSTORAGE_HPP__ */
@@ -2,25 +2,144 @@
 #define CARAMELMATH_MATRIX_SIMDSTORAGE_HPP__
 
 #include <array>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
 
 #include "../detail/helper-type-traits.hpp"
+#include "../simd/Double4.hpp"
 #include "../simd/Float4.hpp"
+#include "../simd/Float8.hpp"
 #include "../setup.hpp"
-#include "matrixfwd.hpp"
+#include "matrix-coordinates.hpp"
+#include "Matrix.template.hpp"
+#include "ViewStorage.hpp"
 
 namespace caramel_math::matrix {
 
+namespace detail {
+
+template <class ScalarType>
+struct SimdColumnType;
+
+template <>
+struct SimdColumnType<float> {
+	using Type = simd::Float4;
+};
+
+template <>
+struct SimdColumnType<double> {
+	using Type = simd::Double4;
+};
+
+// Lane access by runtime index, kept in registers instead of storing the column to memory and reloading it.
+// Extraction jumps to a single shuffle (folded away when the index is known after inlining). Insertion blends
+// the replicated value into the lane selected by comparing the index against the lane numbers, which stays
+// branchless in the row loops of the generic algorithms.
+template <class ColumnType>
+auto extractLane(const ColumnType& column, size_t lane) noexcept {
+	switch (lane) {
+	case 0:
+		return column.template extractLane<0>();
+	case 1:
+		return column.template extractLane<1>();
+	case 2:
+		return column.template extractLane<2>();
+	default:
+		return column.template extractLane<3>();
+	}
+}
+
+template <class ColumnType, class Scalar>
+ColumnType insertLane(const ColumnType& column, size_t lane, Scalar value) noexcept {
+	const auto laneNumbers = ColumnType({ Scalar(0), Scalar(1), Scalar(2), Scalar(3) });
+	return select(cmpEq(laneNumbers, ColumnType(static_cast<Scalar>(lane))), ColumnType(value), column);
+}
+
+template <class StorageType>
+struct IsSimdStorage {
+	enum { VALUE = false };
+};
+
+template <class ScalarTraitsType, class ErrorHandlerType>
+struct IsSimdStorage<SimdStorage<ScalarTraitsType, ErrorHandlerType>> {
+	enum { VALUE = true };
+};
+
+// Row-major 4x4 layouts of ScalarType, whose rows load straight into SIMD registers. Of the layouts not storing
+// every row, only those of affine transforms are accepted, their last row being known.
+template <class StorageType, class ScalarType, class = void>
+struct HasSimdRowLayout {
+	enum { VALUE = false };
+};
+
+template <class StorageType, class ScalarType>
+struct HasSimdRowLayout<StorageType, ScalarType, std::enable_if_t<HasContiguousLayout<StorageType>::VALUE>> {
+	enum {
+		VALUE =
+			std::is_same_v<typename StorageType::Scalar, ScalarType> &&
+			StorageType::ROWS == 4 &&
+			StorageType::COLUMNS == 4 &&
+			StorageType::MAJOR_ORDER == MajorOrder::ROW &&
+			StorageType::ROW_STRIDE == 4 &&
+			StorageType::COLUMN_STRIDE == 1 &&
+			(HasDenseLayout<StorageType>::VALUE || IsAffineTransformStorage<StorageType>::VALUE)
+	};
+};
+
+// Affine transforms combined with SimdStorage matrices yield SimdStorage matrices.
+template <
+	class AffineScalarTraitsType,
+	class AffineErrorHandlerType,
+	class SimdScalarTraitsType,
+	class SimdErrorHandlerType
+	>
+struct BinaryOperatorResultType<
+	AffineTransformStorage<AffineScalarTraitsType, AffineErrorHandlerType>,
+	SimdStorage<SimdScalarTraitsType, SimdErrorHandlerType>,
+	4,
+	4
+	>
+{
+	using Type = SimdStorage<SimdScalarTraitsType, SimdErrorHandlerType>;
+};
+
+template <
+	class SimdScalarTraitsType,
+	class SimdErrorHandlerType,
+	class AffineScalarTraitsType,
+	class AffineErrorHandlerType
+	>
+struct BinaryOperatorResultType<
+	SimdStorage<SimdScalarTraitsType, SimdErrorHandlerType>,
+	AffineTransformStorage<AffineScalarTraitsType, AffineErrorHandlerType>,
+	4,
+	4
+	>
+{
+	using Type = SimdStorage<SimdScalarTraitsType, SimdErrorHandlerType>;
+};
+
+} // namespace detail
+
+// Storage of a 4x4 float or double matrix as four SIMD columns, simd::Float4 or simd::Double4 respectively.
 template <class ScalarTraitsType, class ErrorHandlerType>
 class SimdStorage {
 public:
 
 	using ScalarTraits = ScalarTraitsType;
 
-	static_assert(std::is_same_v<typename ScalarTraits::Scalar, float>, "Non-float scalar type provided");
+	static_assert(
+		std::is_same_v<typename ScalarTraits::Scalar, float> || std::is_same_v<typename ScalarTraits::Scalar, double>,
+		"Non-float, non-double scalar type provided"
+		);
 
-	using Scalar = float;
+	using Scalar = typename ScalarTraits::Scalar;
 
-	using GetReturnType = float;
+	using GetReturnType = Scalar;
+
+	using ColumnType = typename detail::SimdColumnType<Scalar>::Type;
 
 	using ErrorHandler = ErrorHandlerType;
 
@@ -28,6 +147,14 @@ public:
 
 	static constexpr auto COLUMNS = 4;
 
+	static constexpr auto MAJOR_ORDER = MajorOrder::COLUMN;
+
+	static constexpr auto ROW_STRIDE = size_t(1);
+
+	static constexpr auto COLUMN_STRIDE = size_t(ROWS);
+
+	static constexpr auto STORED_ELEMENTS = size_t(ROWS * COLUMNS);
+
 	SimdStorage() = default;
 
 	template <
@@ -40,63 +167,117 @@ public:
 		init_(std::forward<CompatibleValues>(values)...);
 	}
 
-	float get(Row row, Column column) const noexcept(
-		noexcept(ErrorHandler::invalidAccess<float>(row, column)))
+	Scalar get(Row row, Column column) const noexcept(
+		noexcept(ErrorHandler::template invalidAccess<Scalar>(row, column)))
 	{
 		if constexpr (RUNTIME_CHECKS) {
 			if (row.value() >= ROWS || column.value() >= COLUMNS) {
-				return ErrorHandler::invalidAccess<float>(row, column);
+				return ErrorHandler::template invalidAccess<Scalar>(row, column);
 			}
 		}
-		return columns_[column.value()].xyzw()[row.value()];
+		return detail::extractLane(columns_[column.value()], row.value());
 	}
 
 	void set(Row row, Column column, Scalar scalar) noexcept(
-		noexcept(ErrorHandler::invalidAccess<float>(row, column)))
+		noexcept(ErrorHandler::template invalidAccess<Scalar>(row, column)))
 	{
 		if constexpr (RUNTIME_CHECKS) {
 			if (row.value() >= ROWS || column.value() >= COLUMNS) {
-				ErrorHandler::invalidAccess<float>(row, column);
+				ErrorHandler::template invalidAccess<Scalar>(row, column);
 				return;
 			}
 		}
-		auto xyzw = columns_[column.value()].xyzw();
-		xyzw[row.value()] = std::move(scalar);
-		columns_[column.value()] = simd::Float4(xyzw);
+		columns_[column.value()] = detail::insertLane(columns_[column.value()], row.value(), scalar);
 	}
 
-	simd::Float4 get(Column column) const noexcept(
-		noexcept(ErrorHandler::invalidAccess<simd::Float4>(Row(0), column))) // TODO
+	ColumnType get(Column column) const noexcept(
+		noexcept(ErrorHandler::template invalidAccess<ColumnType>(Row(0), column))) // TODO
 	{
 		if constexpr (RUNTIME_CHECKS) {
 			if (column.value() >= COLUMNS) {
-				return ErrorHandler::invalidAccess<simd::Float4>(Row(0), column); // TODO
+				return ErrorHandler::template invalidAccess<ColumnType>(Row(0), column); // TODO
 			}
 		}
 		return columns_[column.value()];
 	}
 
-	void set(Column column, simd::Float4 value) noexcept(
-		noexcept(ErrorHandler::invalidAccess<simd::Float4>(Row(0), column))) // TODO
+	void set(Column column, ColumnType value) noexcept(
+		noexcept(ErrorHandler::template invalidAccess<ColumnType>(Row(0), column))) // TODO
 	{
 		if constexpr (RUNTIME_CHECKS) {
 			if (column.value() >= COLUMNS) {
-				ErrorHandler::invalidAccess<simd::Float4>(Row(0), column); // TODO
+				ErrorHandler::template invalidAccess<ColumnType>(Row(0), column); // TODO
 				return;
 			}
 		}
 		columns_[column.value()] = std::move(value);
 	}
 
+	// The columns viewed as one array of scalars, each column occupying exactly its four lanes.
+	Scalar* data() noexcept {
+		return reinterpret_cast<Scalar*>(columns_.data());
+	}
+
+	const Scalar* data() const noexcept {
+		return reinterpret_cast<const Scalar*>(columns_.data());
+	}
+
+	// Conversion from row-major storages: loads their rows and transposes them in registers. The implicit last
+	// row of affine transforms is not read from memory.
+	template <class SourceStorageType>
+	auto assignFrom(const SourceStorageType& source) noexcept
+		-> std::enable_if_t<detail::HasSimdRowLayout<SourceStorageType, Scalar>::VALUE>
+	{
+		const auto* sourceData = source.data();
+		columns_[0] = ColumnType::loadUnaligned(sourceData);
+		columns_[1] = ColumnType::loadUnaligned(sourceData + 4);
+		columns_[2] = ColumnType::loadUnaligned(sourceData + 8);
+		if constexpr (detail::HasDenseLayout<SourceStorageType>::VALUE) {
+			columns_[3] = ColumnType::loadUnaligned(sourceData + 12);
+		} else {
+			columns_[3] = ColumnType({ ScalarTraits::ZERO, ScalarTraits::ZERO, ScalarTraits::ZERO, ScalarTraits::ONE });
+		}
+		simd::transpose(columns_[0], columns_[1], columns_[2], columns_[3]);
+	}
+
+	// Conversion to dense row-major storages: transposes the columns in registers and stores them as rows.
+	template <class TargetStorageType>
+	auto assignTo(TargetStorageType& target) const noexcept -> std::enable_if_t<
+		detail::HasSimdRowLayout<TargetStorageType, Scalar>::VALUE &&
+		detail::HasDenseLayout<TargetStorageType>::VALUE
+		>
+	{
+		auto row0 = columns_[0];
+		auto row1 = columns_[1];
+		auto row2 = columns_[2];
+		auto row3 = columns_[3];
+		simd::transpose(row0, row1, row2, row3);
+
+		auto* targetData = target.data();
+		row0.storeUnaligned(targetData);
+		row1.storeUnaligned(targetData + 4);
+		row2.storeUnaligned(targetData + 8);
+		row3.storeUnaligned(targetData + 12);
+	}
+
+	// Transposes the four columns in registers. Used by Matrix::transpose().
+	void transposeInPlace() noexcept {
+		simd::transpose(columns_[0], columns_[1], columns_[2], columns_[3]);
+	}
+
 private:
 
-	std::array<simd::Float4, COLUMNS> columns_;
+	std::array<ColumnType, COLUMNS> columns_;
+
+	static_assert(alignof(std::array<ColumnType, COLUMNS>) >= ColumnType::ALIGNMENT);
+
+	static_assert(sizeof(std::array<ColumnType, COLUMNS>) == sizeof(Scalar) * ROWS * COLUMNS);
 
 	template <class... Tail>
 	void init_(Tail&&... tail) noexcept {
-		const auto rawData = std::array<float, ROWS * COLUMNS>{ std::forward<Tail>(tail)... };
+		const auto rawData = std::array<Scalar, ROWS * COLUMNS>{ std::forward<Tail>(tail)... };
 		for (auto columnIdx = 0u; columnIdx < COLUMNS; ++columnIdx) {
-			columns_[columnIdx] = simd::Float4({
+			columns_[columnIdx] = ColumnType({
 				rawData[0 * COLUMNS + columnIdx],
 				rawData[1 * COLUMNS + columnIdx],
 				rawData[2 * COLUMNS + columnIdx],
@@ -107,35 +288,565 @@ private:
 
 };
 
+namespace detail {
+
+// Computes x * c0 + y * c1 + z * c2 + w * c3 for weights.xyzw() == { x, y, z, w }. This is the
+// column kernel of the 4x4 product, kept generic so any Float4 or Double4 implementation can be validated.
+template <class Float4Type>
+Float4Type combineColumns(
+	const Float4Type& c0,
+	const Float4Type& c1,
+	const Float4Type& c2,
+	const Float4Type& c3,
+	const Float4Type& weights
+	) noexcept
+{
+	auto column = c0 * weights.template broadcastLane<0>();
+	column = madd(c1, weights.template broadcastLane<1>(), column);
+	column = madd(c2, weights.template broadcastLane<2>(), column);
+	column = madd(c3, weights.template broadcastLane<3>(), column);
+
+	return column;
+}
+
+template <class ScalarTraitsType, class = void>
+struct HasEpsilon {
+	enum { VALUE = false };
+};
+
+template <class ScalarTraitsType>
+struct HasEpsilon<ScalarTraitsType, std::void_t<decltype(ScalarTraitsType::EPSILON)>> {
+	enum { VALUE = true };
+};
+
+// 2x2 matrix products on Float4s holding { m00, m01, m10, m11 }, where A# denotes the adjugate of A.
+
+// Computes lhs * rhs.
+template <class Float4Type>
+Float4Type multiply2x2(const Float4Type& lhs, const Float4Type& rhs) noexcept {
+	return
+		lhs * rhs.template shuffle<0, 3, 0, 3>() +
+		lhs.template shuffle<1, 0, 3, 2>() * rhs.template shuffle<2, 1, 2, 1>();
+}
+
+// Computes lhs# * rhs.
+template <class Float4Type>
+Float4Type adjugateMultiply2x2(const Float4Type& lhs, const Float4Type& rhs) noexcept {
+	return
+		lhs.template shuffle<3, 3, 0, 0>() * rhs -
+		lhs.template shuffle<1, 1, 2, 2>() * rhs.template shuffle<2, 3, 0, 1>();
+}
+
+// Computes lhs * rhs#.
+template <class Float4Type>
+Float4Type multiplyAdjugate2x2(const Float4Type& lhs, const Float4Type& rhs) noexcept {
+	return
+		lhs * rhs.template shuffle<3, 0, 3, 0>() -
+		lhs.template shuffle<1, 0, 3, 2>() * rhs.template shuffle<2, 1, 2, 1>();
+}
+
+// Splits the 4x4 matrix with rows r0 to r3 into the 2x2 blocks | A B ; C D | and computes the shared 2x2
+// sub-determinants and adjugate products needed by both the determinant and the inverse. Since the
+// determinant of a matrix equals that of its transpose, passing columns instead of rows works just as well.
+template <class Float4Type>
+struct BlockDecomposition4x4 {
+
+	BlockDecomposition4x4(const Float4Type& r0, const Float4Type& r1, const Float4Type& r2, const Float4Type& r3)
+		noexcept :
+		a(simd::shuffle<0, 1, 0, 1>(r0, r1)),
+		b(simd::shuffle<2, 3, 2, 3>(r0, r1)),
+		c(simd::shuffle<0, 1, 0, 1>(r2, r3)),
+		d(simd::shuffle<2, 3, 2, 3>(r2, r3))
+	{
+		// { |A|, |B|, |C|, |D| }
+		const auto blockDeterminants =
+			simd::shuffle<0, 2, 0, 2>(r0, r2) * simd::shuffle<1, 3, 1, 3>(r1, r3) -
+			simd::shuffle<1, 3, 1, 3>(r0, r2) * simd::shuffle<0, 2, 0, 2>(r1, r3);
+		detA = blockDeterminants.template broadcastLane<0>();
+		detB = blockDeterminants.template broadcastLane<1>();
+		detC = blockDeterminants.template broadcastLane<2>();
+		detD = blockDeterminants.template broadcastLane<3>();
+
+		adjugateAB = adjugateMultiply2x2(a, b);
+		adjugateDC = adjugateMultiply2x2(d, c);
+
+		// |M| = |A| |D| + |B| |C| - tr((A# B) (D# C))
+		const auto trace = horizontalAdd(adjugateAB * adjugateDC.template shuffle<0, 2, 1, 3>());
+		determinant = detA * detD + detB * detC - trace;
+	}
+
+	Float4Type a;
+
+	Float4Type b;
+
+	Float4Type c;
+
+	Float4Type d;
+
+	Float4Type detA;
+
+	Float4Type detB;
+
+	Float4Type detC;
+
+	Float4Type detD;
+
+	Float4Type adjugateAB;
+
+	Float4Type adjugateDC;
+
+	// Replicated across all lanes.
+	Float4Type determinant;
+
+};
+
+// Inverts the 4x4 matrix with rows r0 to r3 given its block decomposition, storing the rows of the inverse in
+// place. The determinant must not be zero. As the inverse of the transpose is the transpose of the inverse,
+// passing columns yields the columns of the inverse.
+template <class Float4Type>
+void invert4x4(
+	const BlockDecomposition4x4<Float4Type>& blocks,
+	Float4Type& r0,
+	Float4Type& r1,
+	Float4Type& r2,
+	Float4Type& r3
+	) noexcept
+{
+	// M^-1 = 1 / |M| * | X Y ; Z W |, computed here as the adjugates X#, Y#, Z#, W#.
+	auto adjugateX = blocks.detD * blocks.a - multiply2x2(blocks.b, blocks.adjugateDC);
+	auto adjugateW = blocks.detA * blocks.d - multiply2x2(blocks.c, blocks.adjugateAB);
+	auto adjugateY = blocks.detB * blocks.c - multiplyAdjugate2x2(blocks.d, blocks.adjugateAB);
+	auto adjugateZ = blocks.detC * blocks.b - multiplyAdjugate2x2(blocks.a, blocks.adjugateDC);
+
+	const auto reciprocalDeterminant = Float4Type({ 1.0f, -1.0f, -1.0f, 1.0f }) / blocks.determinant;
+	adjugateX *= reciprocalDeterminant;
+	adjugateY *= reciprocalDeterminant;
+	adjugateZ *= reciprocalDeterminant;
+	adjugateW *= reciprocalDeterminant;
+
+	// Undo the adjugates and reassemble the rows in one shuffle each.
+	r0 = simd::shuffle<3, 1, 3, 1>(adjugateX, adjugateY);
+	r1 = simd::shuffle<2, 0, 2, 0>(adjugateX, adjugateY);
+	r2 = simd::shuffle<3, 1, 3, 1>(adjugateZ, adjugateW);
+	r3 = simd::shuffle<2, 0, 2, 0>(adjugateZ, adjugateW);
+}
+
 template <
 	class LHSScalarTraitsType,
 	class LHSErrorHandlerType,
 	class RHSScalarTraitsType,
-	class RHSErrorHandlerType
+	class RHSErrorHandlerType,
+	class ScaleType
 	>
-inline auto operator*(
+inline auto scaledProduct(
 	const Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>& lhs,
-	const Matrix<SimdStorage<RHSScalarTraitsType, RHSErrorHandlerType>>& rhs
+	const Matrix<SimdStorage<RHSScalarTraitsType, RHSErrorHandlerType>>& rhs,
+	const ScaleType& scale
 	) noexcept(noexcept(lhs.get(Row(0), Column(0))) && noexcept(rhs.get(Row(0), Column(0)))) // TODO
 {
 	static_assert(SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>::COLUMNS == 4);
 
 	auto result = Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>();
 
+	const auto lhsColumn0 = lhs.get(Column(0));
+	const auto lhsColumn1 = lhs.get(Column(1));
+	const auto lhsColumn2 = lhs.get(Column(2));
+	const auto lhsColumn3 = lhs.get(Column(3));
+
 	for (auto columnIdx = Column(0); columnIdx.value() < 4; ++columnIdx) {
-		const auto rhsColumnXyzw = rhs.get(columnIdx).xyzw();
+		result.set(
+			columnIdx,
+			scale(combineColumns(lhsColumn0, lhsColumn1, lhsColumn2, lhsColumn3, rhs.get(columnIdx)))
+			);
+	}
 
-		auto column = lhs.get(Column(0)) * simd::Float4(rhsColumnXyzw[0]);
-		column += lhs.get(Column(1)) * simd::Float4(rhsColumnXyzw[1]);
-		column += lhs.get(Column(2)) * simd::Float4(rhsColumnXyzw[2]);
-		column += lhs.get(Column(3)) * simd::Float4(rhsColumnXyzw[3]);
+	return result;
+}
 
-		result.set(columnIdx, column);
+// Products of SimdStorage matrices with row-major matrices yielding SimdStorage matrices (e.g. with affine
+// transforms) convert the row-major operand once and use the SIMD kernel. Products yielding ArrayStorage are left
+// to the generic kernel, which reads both layouts directly instead of converting the operand and the result.
+template <
+	class LHSStorageType,
+	class RHSScalarTraitsType,
+	class RHSErrorHandlerType,
+	class ScaleType
+	>
+[[nodiscard]] inline auto scaledProduct(
+	const Matrix<LHSStorageType>& lhs,
+	const Matrix<SimdStorage<RHSScalarTraitsType, RHSErrorHandlerType>>& rhs,
+	const ScaleType& scale
+	) noexcept(noexcept(rhs.get(Column(0)))) -> std::enable_if_t<
+		HasSimdRowLayout<LHSStorageType, typename RHSScalarTraitsType::Scalar>::VALUE &&
+		std::is_same_v<
+			matrix::BinaryOperatorResultType<LHSStorageType, SimdStorage<RHSScalarTraitsType, RHSErrorHandlerType>, 4, 4>,
+			SimdStorage<RHSScalarTraitsType, RHSErrorHandlerType>
+			>,
+		Matrix<SimdStorage<RHSScalarTraitsType, RHSErrorHandlerType>>
+		>
+{
+	return scaledProduct(Matrix<SimdStorage<RHSScalarTraitsType, RHSErrorHandlerType>>(lhs), rhs, scale);
+}
+
+template <
+	class LHSScalarTraitsType,
+	class LHSErrorHandlerType,
+	class RHSStorageType,
+	class ScaleType
+	>
+[[nodiscard]] inline auto scaledProduct(
+	const Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>& lhs,
+	const Matrix<RHSStorageType>& rhs,
+	const ScaleType& scale
+	) noexcept(noexcept(lhs.get(Column(0)))) -> std::enable_if_t<
+		HasSimdRowLayout<RHSStorageType, typename LHSScalarTraitsType::Scalar>::VALUE &&
+		std::is_same_v<
+			matrix::BinaryOperatorResultType<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>, RHSStorageType, 4, 4>,
+			SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>
+			>,
+		Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>
+		>
+{
+	return scaledProduct(lhs, Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>(rhs), scale);
+}
+
+// Products with transposed views of SimdStorage matrices (e.g. A^T * B, A * B^T) transpose the viewed columns in
+// registers and use the SIMD kernel, instead of reading the view element by element.
+template <
+	class ViewedMatrixType,
+	class RHSScalarTraitsType,
+	class RHSErrorHandlerType,
+	class ScaleType
+	>
+[[nodiscard]] inline auto scaledProduct(
+	const Matrix<TransposedViewStorage<ViewedMatrixType>>& lhs,
+	const Matrix<SimdStorage<RHSScalarTraitsType, RHSErrorHandlerType>>& rhs,
+	const ScaleType& scale
+	) noexcept(noexcept(rhs.get(Column(0)))) -> std::enable_if_t<
+		std::is_same_v<typename ViewedMatrixType::Storage, SimdStorage<RHSScalarTraitsType, RHSErrorHandlerType>>,
+		Matrix<SimdStorage<RHSScalarTraitsType, RHSErrorHandlerType>>
+		>
+{
+	return scaledProduct(transposed(lhs.storage().viewedMatrix()), rhs, scale);
+}
+
+template <
+	class LHSScalarTraitsType,
+	class LHSErrorHandlerType,
+	class ViewedMatrixType,
+	class ScaleType
+	>
+[[nodiscard]] inline auto scaledProduct(
+	const Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>& lhs,
+	const Matrix<TransposedViewStorage<ViewedMatrixType>>& rhs,
+	const ScaleType& scale
+	) noexcept(noexcept(lhs.get(Column(0)))) -> std::enable_if_t<
+		std::is_same_v<typename ViewedMatrixType::Storage, SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>,
+		Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>
+		>
+{
+	return scaledProduct(lhs, transposed(rhs.storage().viewedMatrix()), scale);
+}
+
+// A^T * B^T is evaluated as (B * A)^T.
+template <
+	class LHSViewedMatrixType,
+	class RHSViewedMatrixType,
+	class ScaleType
+	>
+[[nodiscard]] inline auto scaledProduct(
+	const Matrix<TransposedViewStorage<LHSViewedMatrixType>>& lhs,
+	const Matrix<TransposedViewStorage<RHSViewedMatrixType>>& rhs,
+	const ScaleType& scale
+	) noexcept(noexcept(lhs.get(Row(0), Column(0))) && noexcept(rhs.get(Row(0), Column(0)))) -> std::enable_if_t<
+		IsSimdStorage<typename LHSViewedMatrixType::Storage>::VALUE &&
+		std::is_same_v<typename LHSViewedMatrixType::Storage, typename RHSViewedMatrixType::Storage>,
+		Matrix<typename LHSViewedMatrixType::Storage>
+		>
+{
+	return transposed(scaledProduct(rhs.storage().viewedMatrix(), lhs.storage().viewedMatrix(), scale));
+}
+
+} // namespace detail
+
+// Computes { lhs0 * rhs0, lhs1 * rhs1 } in one pass. Each Float8 carries a column of the first product in
+// its low half and the matching column of the second product in its high half, so with AVX the work of
+// two Float4 products is done by the instructions of one. Results equal those of operator*.
+template <
+	class LHSScalarTraitsType,
+	class LHSErrorHandlerType,
+	class RHSScalarTraitsType,
+	class RHSErrorHandlerType
+	>
+inline auto multiplyPairs(
+	const Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>& lhs0,
+	const Matrix<SimdStorage<RHSScalarTraitsType, RHSErrorHandlerType>>& rhs0,
+	const Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>& lhs1,
+	const Matrix<SimdStorage<RHSScalarTraitsType, RHSErrorHandlerType>>& rhs1
+	) noexcept(noexcept(lhs0.get(Column(0))) && noexcept(rhs0.get(Column(0))))
+{
+	using ResultMatrix = Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>;
+	static_assert(std::is_same_v<typename ResultMatrix::Scalar, float>, "Paired products require float matrices");
+
+	auto result = std::pair<ResultMatrix, ResultMatrix>();
+
+	const auto lhsColumn0 = simd::Float8::fromHalves(lhs0.get(Column(0)), lhs1.get(Column(0)));
+	const auto lhsColumn1 = simd::Float8::fromHalves(lhs0.get(Column(1)), lhs1.get(Column(1)));
+	const auto lhsColumn2 = simd::Float8::fromHalves(lhs0.get(Column(2)), lhs1.get(Column(2)));
+	const auto lhsColumn3 = simd::Float8::fromHalves(lhs0.get(Column(3)), lhs1.get(Column(3)));
+
+	for (auto columnIdx = Column(0); columnIdx.value() < 4; ++columnIdx) {
+		const auto weights = simd::Float8::fromHalves(rhs0.get(columnIdx), rhs1.get(columnIdx));
+		const auto column = detail::combineColumns(lhsColumn0, lhsColumn1, lhsColumn2, lhsColumn3, weights);
+		result.first.set(columnIdx, column.lowHalf());
+		result.second.set(columnIdx, column.highHalf());
 	}
 
 	return result;
 }
 
+// Compares all four columns at once, with one branch instead of one per element. If ScalarTraits provide
+// EPSILON, elements are equal if they differ by at most that much, otherwise they must match exactly.
+template <
+	class LHSScalarTraitsType,
+	class LHSErrorHandlerType,
+	class RHSScalarTraitsType,
+	class RHSErrorHandlerType
+	>
+[[nodiscard]] inline bool operator==(
+	const Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>& lhs,
+	const Matrix<SimdStorage<RHSScalarTraitsType, RHSErrorHandlerType>>& rhs
+	) noexcept(noexcept(lhs.get(Column(0))) && noexcept(rhs.get(Column(0))))
+{
+	if constexpr (detail::HasEpsilon<LHSScalarTraitsType>::VALUE) {
+		using ColumnType = typename SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>::ColumnType;
+		const auto epsilon = ColumnType(LHSScalarTraitsType::EPSILON);
+
+		// Two-sided like ScalarTraits::equal, so that equal infinities compare equal.
+		const auto columnsEqual = [&epsilon](const ColumnType& lhsColumn, const ColumnType& rhsColumn) {
+			return cmpLe(lhsColumn, rhsColumn + epsilon) & cmpLe(rhsColumn - epsilon, lhsColumn);
+		};
+
+		auto equal = columnsEqual(lhs.get(Column(0)), rhs.get(Column(0)));
+		equal &= columnsEqual(lhs.get(Column(1)), rhs.get(Column(1)));
+		equal &= columnsEqual(lhs.get(Column(2)), rhs.get(Column(2)));
+		equal &= columnsEqual(lhs.get(Column(3)), rhs.get(Column(3)));
+
+		return all(equal);
+	} else {
+		auto equal = cmpEq(lhs.get(Column(0)), rhs.get(Column(0)));
+		equal &= cmpEq(lhs.get(Column(1)), rhs.get(Column(1)));
+		equal &= cmpEq(lhs.get(Column(2)), rhs.get(Column(2)));
+		equal &= cmpEq(lhs.get(Column(3)), rhs.get(Column(3)));
+
+		return all(equal);
+	}
+}
+
+template <class ScalarTraitsType, class ErrorHandlerType>
+inline Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>& operator*=(
+	Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>& matrix,
+	typename ScalarTraitsType::Scalar scalar
+	) noexcept(noexcept(matrix.get(Column(0))))
+{
+	const auto factor = typename SimdStorage<ScalarTraitsType, ErrorHandlerType>::ColumnType(scalar);
+	for (auto columnIdx = Column(0); columnIdx.value() < 4; ++columnIdx) {
+		matrix.set(columnIdx, matrix.get(columnIdx) * factor);
+	}
+
+	return matrix;
+}
+
+// Multiplies by the reciprocal, so only one division is done.
+template <class ScalarTraitsType, class ErrorHandlerType>
+inline Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>& operator/=(
+	Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>& matrix,
+	typename ScalarTraitsType::Scalar scalar
+	) noexcept(noexcept(matrix.get(Column(0))))
+{
+	using Scalar = typename ScalarTraitsType::Scalar;
+	return matrix *= Scalar(1) / scalar;
+}
+
+// Element-wise operations work on whole columns, four Float4 or Double4 operations per matrix.
+template <
+	class LHSScalarTraitsType,
+	class LHSErrorHandlerType,
+	class RHSScalarTraitsType,
+	class RHSErrorHandlerType
+	>
+inline Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>& operator+=(
+	Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>& lhs,
+	const Matrix<SimdStorage<RHSScalarTraitsType, RHSErrorHandlerType>>& rhs
+	) noexcept(noexcept(lhs.get(Column(0))) && noexcept(rhs.get(Column(0))))
+{
+	for (auto columnIdx = Column(0); columnIdx.value() < 4; ++columnIdx) {
+		lhs.set(columnIdx, lhs.get(columnIdx) + rhs.get(columnIdx));
+	}
+
+	return lhs;
+}
+
+template <
+	class LHSScalarTraitsType,
+	class LHSErrorHandlerType,
+	class RHSScalarTraitsType,
+	class RHSErrorHandlerType
+	>
+inline Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>& operator-=(
+	Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>& lhs,
+	const Matrix<SimdStorage<RHSScalarTraitsType, RHSErrorHandlerType>>& rhs
+	) noexcept(noexcept(lhs.get(Column(0))) && noexcept(rhs.get(Column(0))))
+{
+	for (auto columnIdx = Column(0); columnIdx.value() < 4; ++columnIdx) {
+		lhs.set(columnIdx, lhs.get(columnIdx) - rhs.get(columnIdx));
+	}
+
+	return lhs;
+}
+
+template <
+	class LHSScalarTraitsType,
+	class LHSErrorHandlerType,
+	class RHSScalarTraitsType,
+	class RHSErrorHandlerType
+	>
+[[nodiscard]] inline Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>> operator+(
+	const Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>& lhs,
+	const Matrix<SimdStorage<RHSScalarTraitsType, RHSErrorHandlerType>>& rhs
+	) noexcept(noexcept(lhs.get(Column(0))) && noexcept(rhs.get(Column(0))))
+{
+	auto result = Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>();
+
+	for (auto columnIdx = Column(0); columnIdx.value() < 4; ++columnIdx) {
+		result.set(columnIdx, lhs.get(columnIdx) + rhs.get(columnIdx));
+	}
+
+	return result;
+}
+
+template <
+	class LHSScalarTraitsType,
+	class LHSErrorHandlerType,
+	class RHSScalarTraitsType,
+	class RHSErrorHandlerType
+	>
+[[nodiscard]] inline Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>> operator-(
+	const Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>& lhs,
+	const Matrix<SimdStorage<RHSScalarTraitsType, RHSErrorHandlerType>>& rhs
+	) noexcept(noexcept(lhs.get(Column(0))) && noexcept(rhs.get(Column(0))))
+{
+	auto result = Matrix<SimdStorage<LHSScalarTraitsType, LHSErrorHandlerType>>();
+
+	for (auto columnIdx = Column(0); columnIdx.value() < 4; ++columnIdx) {
+		result.set(columnIdx, lhs.get(columnIdx) - rhs.get(columnIdx));
+	}
+
+	return result;
+}
+
+// Multiplies by -1 rather than subtracting from 0, so that zeros change sign too.
+template <class ScalarTraitsType, class ErrorHandlerType>
+[[nodiscard]] inline Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>> operator-(
+	const Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>& matrix
+	) noexcept(noexcept(matrix.get(Column(0))))
+{
+	using ColumnType = typename SimdStorage<ScalarTraitsType, ErrorHandlerType>::ColumnType;
+	const auto minusOne = ColumnType(typename ScalarTraitsType::Scalar(-1));
+
+	auto result = Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>();
+
+	for (auto columnIdx = Column(0); columnIdx.value() < 4; ++columnIdx) {
+		result.set(columnIdx, matrix.get(columnIdx) * minusOne);
+	}
+
+	return result;
+}
+
+// Transposes the four columns in registers, with unpacks and lane permutations, instead of copying through
+// a transposed view.
+template <class ScalarTraitsType, class ErrorHandlerType>
+[[nodiscard]] inline Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>> transposed(
+	const Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>& matrix
+	) noexcept(noexcept(matrix.get(Column(0))))
+{
+	auto column0 = matrix.get(Column(0));
+	auto column1 = matrix.get(Column(1));
+	auto column2 = matrix.get(Column(2));
+	auto column3 = matrix.get(Column(3));
+	transpose(column0, column1, column2, column3);
+
+	auto result = Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>();
+	result.set(Column(0), column0);
+	result.set(Column(1), column1);
+	result.set(Column(2), column2);
+	result.set(Column(3), column3);
+
+	return result;
+}
+
+// Computes the determinant from the 2x2 sub-determinants of the matrix blocks, without cofactor expansion.
+template <class ScalarTraitsType, class ErrorHandlerType>
+[[nodiscard]] inline auto determinant(const Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>& matrix)
+	noexcept(noexcept(matrix.get(Column(0))))
+	-> std::enable_if_t<std::is_same_v<typename ScalarTraitsType::Scalar, float>, float>
+{
+	const auto blocks = detail::BlockDecomposition4x4<simd::Float4>(
+		matrix.get(Column(0)),
+		matrix.get(Column(1)),
+		matrix.get(Column(2)),
+		matrix.get(Column(3))
+		);
+	return blocks.determinant.template extractLane<0>();
+}
+
+// Inverts the matrix blockwise by Cramer's rule, sharing the 2x2 sub-determinants between the determinant
+// and the adjugate. Returns std::nullopt if the matrix is singular, like the generic inverse.
+template <class ScalarTraitsType, class ErrorHandlerType>
+[[nodiscard]] inline auto inverse(const Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>& matrix)
+	noexcept(noexcept(matrix.get(Column(0))))
+	-> std::enable_if_t<
+		std::is_same_v<typename ScalarTraitsType::Scalar, float>,
+		std::optional<Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>>
+		>
+{
+	auto result = std::optional<Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>>();
+
+	auto column0 = matrix.get(Column(0));
+	auto column1 = matrix.get(Column(1));
+	auto column2 = matrix.get(Column(2));
+	auto column3 = matrix.get(Column(3));
+
+	const auto blocks = detail::BlockDecomposition4x4<simd::Float4>(column0, column1, column2, column3);
+
+	if (blocks.determinant.template extractLane<0>() != 0.0f) {
+		detail::invert4x4(blocks, column0, column1, column2, column3);
+
+		result.emplace();
+		result->set(Column(0), column0);
+		result->set(Column(1), column1);
+		result->set(Column(2), column2);
+		result->set(Column(3), column3);
+	}
+
+	return result;
+}
+
+// Writes the matrix to destination as 16 column-major scalars using non-temporal stores, leaving the cache
+// untouched. Intended for filling upload buffers with many transforms: destination must be aligned to
+// ColumnType::ALIGNMENT and simd::streamFence() must be called once all matrices have been written.
+template <class ScalarTraitsType, class ErrorHandlerType>
+inline void streamStore(
+	const Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>& matrix,
+	typename ScalarTraitsType::Scalar* destination
+	) noexcept(noexcept(matrix.get(Column(0))))
+{
+	matrix.get(Column(0)).streamStore(destination);
+	matrix.get(Column(1)).streamStore(destination + 4);
+	matrix.get(Column(2)).streamStore(destination + 8);
+	matrix.get(Column(3)).streamStore(destination + 12);
+}
+
 } // namespace caramel_math::matrix
 
 #endif /* CARAMELMATH_MATRIX_SIMDSTORAGE_HPP__ */
@@ -91,6 +91,16 @@ private:
 
 };
 
+class MatrixArithmeticOverflow final : public std::overflow_error {
+public:
+
+	MatrixArithmeticOverflow() noexcept :
+		std::overflow_error("Matrix arithmetic overflow")
+	{
+	}
+
+};
+
 struct ThrowingErrorHandler final {
 
 	template <class ReturnType>
@@ -109,6 +119,11 @@ struct ThrowingErrorHandler final {
 		throw InvalidMatrixDataValue<ScalarType>(row, column, actualValue, expectedValue);
 	}
 
+	template <class ReturnType>
+	static ReturnType overflow() {
+		throw MatrixArithmeticOverflow();
+	}
+
 };
 
 } // namespace caramel_math::matrix
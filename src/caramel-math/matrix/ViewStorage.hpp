@@ -2,18 +2,64 @@
 #define CARAMELMATH_MATRIX_VIEWSTORAGE_HPP__
 
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 #include "../setup.hpp"
 #include "matrix-coordinates.hpp"
 #include "Matrix.template.hpp"
+#include "storage-traits.hpp"
 
 namespace caramel_math::matrix {
 
+namespace detail {
+
+struct TransposedModifierFunc;
+
+// Layout published by views that are contiguous themselves (see HasContiguousLayout): transposed views of dense
+// storages are the viewed array read with the strides swapped, so kernels over dense layouts read it directly.
+template <class ViewedMatrixType, class ModifierFuncType, class = void>
+struct ViewLayout {
+	static constexpr auto CONTIGUOUS = false;
+};
+
+template <class ViewedMatrixType>
+struct ViewLayout<
+	ViewedMatrixType,
+	TransposedModifierFunc,
+	std::enable_if_t<HasDenseLayout<typename ViewedMatrixType::Storage>::VALUE>
+	>
+{
+	static constexpr auto CONTIGUOUS = true;
+
+	static constexpr auto MAJOR_ORDER =
+		(ViewedMatrixType::Storage::MAJOR_ORDER == MajorOrder::ROW) ? MajorOrder::COLUMN : MajorOrder::ROW;
+
+	static constexpr auto ROW_STRIDE = ViewedMatrixType::Storage::COLUMN_STRIDE;
+
+	static constexpr auto COLUMN_STRIDE = ViewedMatrixType::Storage::ROW_STRIDE;
+
+	static constexpr auto STORED_ELEMENTS = ViewedMatrixType::Storage::STORED_ELEMENTS;
+
+	// Scalar pointer or pointer to const, following the constness of the viewed matrix.
+	using DataPointer = decltype(std::declval<ViewedMatrixType&>().storage().data());
+};
+
 template <
 	class ViewedMatrixType,
 	class ModifierFuncType
 	>
-class ViewStorage {
+struct HasContiguousLayout<ViewStorage<ViewedMatrixType, ModifierFuncType>> {
+	enum { VALUE = ViewLayout<ViewedMatrixType, ModifierFuncType>::CONTIGUOUS };
+};
+
+} // namespace detail
+
+template <
+	class ViewedMatrixType,
+	class ModifierFuncType
+	>
+class ViewStorage : public detail::ViewLayout<ViewedMatrixType, ModifierFuncType> {
 public:
 
 	using ViewedMatrix = ViewedMatrixType;
@@ -52,6 +98,16 @@ public:
 		return viewedMatrix_.set(modifiedRow, modifiedColumn, std::move(scalar));
 	}
 
+	template <class Layout = detail::ViewLayout<ViewedMatrixType, ModifierFuncType>>
+	auto data() noexcept -> typename Layout::DataPointer {
+		return viewedMatrix_.storage().data();
+	}
+
+	template <class Layout = detail::ViewLayout<ViewedMatrixType, ModifierFuncType>>
+	auto data() const noexcept -> std::enable_if_t<Layout::CONTIGUOUS, const Scalar*> {
+		return viewedMatrix_.storage().data();
+	}
+
 	ViewedMatrix& viewedMatrix() noexcept {
 		return viewedMatrix_;
 	}
@@ -166,7 +222,7 @@ inline auto viewSubmatrix(ViewedMatrixType& matrix, Row excludedRow, Column excl
 			)
 		{
 			using ErrorHandler = typename ViewedMatrixType::Storage::ErrorHandler;
-			ErrorHandler::invalidAccess<typename ViewedMatrixType::Scalar>(
+			ErrorHandler::template invalidAccess<typename ViewedMatrixType::Scalar>(
 				excludedRow,
 				excludedColumn
 				);
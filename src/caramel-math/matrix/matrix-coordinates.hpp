@@ -10,7 +10,7 @@ struct Row : private scalar::Value<Row, size_t> {
 
 	constexpr Row() = default;
 
-	constexpr explicit Row(size_t value) :
+	constexpr explicit Row(size_t value) noexcept :
 		Value<Row, size_t>(value)
 	{
 	}
@@ -25,7 +25,7 @@ struct Column : private scalar::Value<Column, size_t> {
 
 	constexpr Column() = default;
 
-	constexpr explicit Column(size_t value) :
+	constexpr explicit Column(size_t value) noexcept :
 		Value<Column, size_t>(value)
 	{
 	}
@@ -36,13 +36,19 @@ struct Column : private scalar::Value<Column, size_t> {
 
 };
 
+// Order in which storages keep their elements in memory, row after row or column after column.
+enum class MajorOrder {
+	ROW,
+	COLUMN,
+};
+
 namespace literals {
 
-constexpr caramel_math::matrix::Row operator""_row(unsigned long long int row) {
+constexpr caramel_math::matrix::Row operator""_row(unsigned long long int row) noexcept {
 	return caramel_math::matrix::Row(size_t(row));
 }
 
-constexpr caramel_math::matrix::Column operator""_col(unsigned long long int column) {
+constexpr caramel_math::matrix::Column operator""_col(unsigned long long int column) noexcept {
 	return caramel_math::matrix::Column(size_t(column));
 }
 
@@ -1,10 +1,11 @@
 #ifndef CARAMELMATH_MATRIX_MATRIXFWD_HPP__
 #define CARAMELMATH_MATRIX_MATRIXFWD_HPP__
 
-namespace caramel_math::matrix {
+#include <cstddef>
+
+#include "matrix-coordinates.hpp"
 
-struct Row;
-struct  Column;
+namespace caramel_math::matrix {
 
 template <class StorageType>
 class Matrix;
@@ -13,7 +14,8 @@ template <
 	class ScalarTraitsType,
 	size_t ROWS_VALUE,
 	size_t COLUMNS_VALUE,
-	class ErrorHandlerType
+	class ErrorHandlerType,
+	MajorOrder MAJOR_ORDER_VALUE = MajorOrder::ROW
 	>
 class ArrayStorage;
 
@@ -32,6 +34,18 @@ class ViewStorage;
 template <class ScalarTraitsType, class ErrorHandlerType>
 class SimdStorage;
 
+template <
+	class ScalarTraitsType,
+	class ErrorHandlerType
+	>
+class SimdAffineTransformStorage;
+
+template <class MatrixType, bool TRANSPOSED>
+class MatrixReferenceExpression;
+
+template <class LHSExpressionType, class RHSExpressionType>
+class MatrixProductExpression;
+
 } // namespace caramel_math::matrix
 
 #endif /* CARAMELMATH_MATRIX_MATRIXFWD_HPP__ */
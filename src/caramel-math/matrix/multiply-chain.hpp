@@ -0,0 +1,81 @@
+#ifndef CARAMELMATH_MATRIX_MULTIPLYCHAIN_HPP__
+#define CARAMELMATH_MATRIX_MULTIPLYCHAIN_HPP__
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include "Matrix.hpp"
+
+namespace caramel_math::matrix {
+
+namespace detail {
+
+// Minimal number of scalar multiplications and the corresponding split points for multiplying a chain of
+// COUNT matrices, the i-th of which is dimensions[i] x dimensions[i + 1]. The product of matrices first..last
+// is best computed as (first..split[first][last]) * (split[first][last] + 1..last).
+template <size_t COUNT>
+struct ChainOrder {
+	std::array<std::array<size_t, COUNT>, COUNT> cost;
+	std::array<std::array<size_t, COUNT>, COUNT> split;
+};
+
+template <size_t COUNT>
+constexpr ChainOrder<COUNT> optimalChainOrder(const std::array<size_t, COUNT + 1>& dimensions) noexcept {
+	auto order = ChainOrder<COUNT>{};
+
+	for (auto length = size_t(2); length <= COUNT; ++length) {
+		for (auto first = size_t(0); first + length <= COUNT; ++first) {
+			const auto last = first + length - 1;
+
+			order.cost[first][last] = ~size_t(0);
+
+			for (auto split = first; split < last; ++split) {
+				const auto cost =
+					order.cost[first][split] +
+					order.cost[split + 1][last] +
+					dimensions[first] * dimensions[split + 1] * dimensions[last + 1];
+				if (cost < order.cost[first][last]) {
+					order.cost[first][last] = cost;
+					order.split[first][last] = split;
+				}
+			}
+		}
+	}
+
+	return order;
+}
+
+template <class FirstMatrixType, class... MatrixTypes>
+constexpr auto CHAIN_ORDER = optimalChainOrder<sizeof...(MatrixTypes) + 1>(
+	{ FirstMatrixType::ROWS, FirstMatrixType::COLUMNS, MatrixTypes::COLUMNS... });
+
+template <size_t FIRST, size_t LAST, class... MatrixTypes>
+decltype(auto) multiplyRange(const std::tuple<const MatrixTypes&...>& matrices) {
+	if constexpr (FIRST == LAST) {
+		return std::get<FIRST>(matrices);
+	} else {
+		constexpr auto SPLIT = CHAIN_ORDER<MatrixTypes...>.split[FIRST][LAST];
+		return multiplyRange<FIRST, SPLIT>(matrices) * multiplyRange<SPLIT + 1, LAST>(matrices);
+	}
+}
+
+} // namespace detail
+
+// Multiplies matrices in the order with the fewest scalar multiplications, found at compile time from their
+// sizes. E.g. for A (3x8), B (8x8) and C (8x1) it computes A * (B * C), 88 multiplications instead of 216.
+// The operands are never copied, only the intermediate products are stored.
+template <class... StorageTypes>
+[[nodiscard]] inline auto multiplyChain(const Matrix<StorageTypes>&... matrices) {
+	static_assert(sizeof...(StorageTypes) > 0, "Can't multiply an empty chain");
+	constexpr auto LAST = sizeof...(StorageTypes) - 1;
+
+	const auto operands = std::tie(matrices...);
+	using ResultType = std::decay_t<decltype(detail::multiplyRange<0, LAST>(operands))>;
+	return ResultType(detail::multiplyRange<0, LAST>(operands));
+}
+
+} // namespace caramel_math::matrix
+
+#endif /* CARAMELMATH_MATRIX_MULTIPLYCHAIN_HPP__ */
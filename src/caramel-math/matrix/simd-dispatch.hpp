@@ -0,0 +1,328 @@
+#ifndef CARAMELMATH_MATRIX_SIMDDISPATCH_HPP__
+#define CARAMELMATH_MATRIX_SIMDDISPATCH_HPP__
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+
+#include "../simd/cpu-features.hpp"
+#include "../simd/detail/instruction-sets.hpp"
+#include "Matrix.hpp"
+#include "SimdStorage.hpp"
+
+#if defined(CARAMELMATH_SIMD_X86) && !defined(CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION)
+#	define CARAMELMATH_MATRIX_SIMD_DISPATCH_X86
+#	include <immintrin.h>
+#endif /* defined(CARAMELMATH_SIMD_X86) && !defined(CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION) */
+
+namespace caramel_math::matrix::dispatch {
+
+// Kernels for Matrix<SimdStorage> bound to one instruction set tier. Tiers above the compile-time
+// baseline use fused multiply-add, so their results may differ from operator* in the last bit. Only float
+// matrices have dedicated kernels so far, double ones always use the baseline.
+template <class MatrixType>
+struct SimdKernels {
+
+	using MultiplyFunction = MatrixType (*)(const MatrixType& lhs, const MatrixType& rhs);
+
+	// Computes result[i] = lhs[i] * rhs[i] for i < count.
+	using MultiplyBatchFunction = void (*)(
+		const MatrixType* lhs, const MatrixType* rhs, MatrixType* result, size_t count);
+
+	// Returns std::nullopt if the matrix is singular, like inverse.
+	using InverseFunction = std::optional<MatrixType> (*)(const MatrixType& matrix);
+
+	MultiplyFunction multiply;
+
+	MultiplyBatchFunction multiplyBatch;
+
+	InverseFunction inverse;
+
+};
+
+namespace detail {
+
+template <class MatrixType>
+MatrixType multiplyBaseline(const MatrixType& lhs, const MatrixType& rhs) {
+	return lhs * rhs;
+}
+
+template <class MatrixType>
+void multiplyBatchBaseline(const MatrixType* lhs, const MatrixType* rhs, MatrixType* result, size_t count) {
+	for (auto i = size_t(0); i < count; ++i) {
+		result[i] = lhs[i] * rhs[i];
+	}
+}
+
+template <class MatrixType>
+std::optional<MatrixType> inverseBaseline(const MatrixType& matrix) {
+	return caramel_math::matrix::inverse(matrix);
+}
+
+#if defined(CARAMELMATH_MATRIX_SIMD_DISPATCH_X86)
+
+template <class MatrixType>
+CARAMELMATH_SIMD_TARGET("avx2,fma")
+MatrixType multiplyAvx2(const MatrixType& lhs, const MatrixType& rhs) {
+	const auto lhsColumn0 = lhs.get(Column(0)).data();
+	const auto lhsColumn1 = lhs.get(Column(1)).data();
+	const auto lhsColumn2 = lhs.get(Column(2)).data();
+	const auto lhsColumn3 = lhs.get(Column(3)).data();
+
+	auto result = MatrixType();
+
+	for (auto columnIdx = Column(0); columnIdx.value() < 4; ++columnIdx) {
+		const auto weights = rhs.get(columnIdx).data();
+		auto column = _mm_mul_ps(lhsColumn0, _mm_shuffle_ps(weights, weights, _MM_SHUFFLE(0, 0, 0, 0)));
+		column = _mm_fmadd_ps(lhsColumn1, _mm_shuffle_ps(weights, weights, _MM_SHUFFLE(1, 1, 1, 1)), column);
+		column = _mm_fmadd_ps(lhsColumn2, _mm_shuffle_ps(weights, weights, _MM_SHUFFLE(2, 2, 2, 2)), column);
+		column = _mm_fmadd_ps(lhsColumn3, _mm_shuffle_ps(weights, weights, _MM_SHUFFLE(3, 3, 3, 3)), column);
+		result.set(columnIdx, simd::Float4::fromData(column));
+	}
+
+	return result;
+}
+
+template <class MatrixType>
+CARAMELMATH_SIMD_TARGET("avx2,fma")
+__m256 packColumnsAvx2(const MatrixType& low, const MatrixType& high, Column column) {
+	return _mm256_insertf128_ps(_mm256_castps128_ps256(low.get(column).data()), high.get(column).data(), 1);
+}
+
+// Two products per iteration, one in each 128-bit half of the ymm registers.
+template <class MatrixType>
+CARAMELMATH_SIMD_TARGET("avx2,fma")
+void multiplyBatchAvx2(const MatrixType* lhs, const MatrixType* rhs, MatrixType* result, size_t count) {
+	auto i = size_t(0);
+	for (; i + 2 <= count; i += 2) {
+		const auto lhsColumn0 = packColumnsAvx2(lhs[i], lhs[i + 1], Column(0));
+		const auto lhsColumn1 = packColumnsAvx2(lhs[i], lhs[i + 1], Column(1));
+		const auto lhsColumn2 = packColumnsAvx2(lhs[i], lhs[i + 1], Column(2));
+		const auto lhsColumn3 = packColumnsAvx2(lhs[i], lhs[i + 1], Column(3));
+
+		for (auto columnIdx = Column(0); columnIdx.value() < 4; ++columnIdx) {
+			const auto weights = packColumnsAvx2(rhs[i], rhs[i + 1], columnIdx);
+			auto column = _mm256_mul_ps(lhsColumn0, _mm256_shuffle_ps(weights, weights, _MM_SHUFFLE(0, 0, 0, 0)));
+			column = _mm256_fmadd_ps(lhsColumn1, _mm256_shuffle_ps(weights, weights, _MM_SHUFFLE(1, 1, 1, 1)), column);
+			column = _mm256_fmadd_ps(lhsColumn2, _mm256_shuffle_ps(weights, weights, _MM_SHUFFLE(2, 2, 2, 2)), column);
+			column = _mm256_fmadd_ps(lhsColumn3, _mm256_shuffle_ps(weights, weights, _MM_SHUFFLE(3, 3, 3, 3)), column);
+			result[i].set(columnIdx, simd::Float4::fromData(_mm256_castps256_ps128(column)));
+			result[i + 1].set(columnIdx, simd::Float4::fromData(_mm256_extractf128_ps(column, 1)));
+		}
+	}
+
+	if (i < count) {
+		result[i] = multiplyAvx2(lhs[i], rhs[i]);
+	}
+}
+
+template <class MatrixType>
+CARAMELMATH_SIMD_TARGET("avx512f,avx2,fma")
+__m512 packColumnsAvx512(const MatrixType* matrices, Column column) {
+	auto packed = _mm512_castps128_ps512(matrices[0].get(column).data());
+	packed = _mm512_insertf32x4(packed, matrices[1].get(column).data(), 1);
+	packed = _mm512_insertf32x4(packed, matrices[2].get(column).data(), 2);
+	return _mm512_insertf32x4(packed, matrices[3].get(column).data(), 3);
+}
+
+// Four products per iteration, one in each 128-bit lane of the zmm registers. Lanes are extracted with
+// the zero-masking form, the plain one triggers false uninitialised value warnings in some GCC versions.
+template <class MatrixType>
+CARAMELMATH_SIMD_TARGET("avx512f,avx2,fma")
+void multiplyBatchAvx512(const MatrixType* lhs, const MatrixType* rhs, MatrixType* result, size_t count) {
+	auto i = size_t(0);
+	for (; i + 4 <= count; i += 4) {
+		const auto lhsColumn0 = packColumnsAvx512(lhs + i, Column(0));
+		const auto lhsColumn1 = packColumnsAvx512(lhs + i, Column(1));
+		const auto lhsColumn2 = packColumnsAvx512(lhs + i, Column(2));
+		const auto lhsColumn3 = packColumnsAvx512(lhs + i, Column(3));
+
+		for (auto columnIdx = Column(0); columnIdx.value() < 4; ++columnIdx) {
+			const auto weights = packColumnsAvx512(rhs + i, columnIdx);
+			auto column = _mm512_mul_ps(lhsColumn0, _mm512_shuffle_ps(weights, weights, _MM_SHUFFLE(0, 0, 0, 0)));
+			column = _mm512_fmadd_ps(lhsColumn1, _mm512_shuffle_ps(weights, weights, _MM_SHUFFLE(1, 1, 1, 1)), column);
+			column = _mm512_fmadd_ps(lhsColumn2, _mm512_shuffle_ps(weights, weights, _MM_SHUFFLE(2, 2, 2, 2)), column);
+			column = _mm512_fmadd_ps(lhsColumn3, _mm512_shuffle_ps(weights, weights, _MM_SHUFFLE(3, 3, 3, 3)), column);
+			result[i].set(columnIdx, simd::Float4::fromData(_mm512_maskz_extractf32x4_ps(0xff, column, 0)));
+			result[i + 1].set(columnIdx, simd::Float4::fromData(_mm512_maskz_extractf32x4_ps(0xff, column, 1)));
+			result[i + 2].set(columnIdx, simd::Float4::fromData(_mm512_maskz_extractf32x4_ps(0xff, column, 2)));
+			result[i + 3].set(columnIdx, simd::Float4::fromData(_mm512_maskz_extractf32x4_ps(0xff, column, 3)));
+		}
+	}
+
+	multiplyBatchAvx2(lhs + i, rhs + i, result + i, count - i);
+}
+
+// Returns { low[X], low[Y], high[Z], high[W] }, as simd::shuffle does.
+template <int X, int Y, int Z, int W>
+CARAMELMATH_SIMD_TARGET("avx2,fma")
+__m128 shuffleAvx2(__m128 low, __m128 high) {
+	return _mm_shuffle_ps(low, high, _MM_SHUFFLE(W, Z, Y, X));
+}
+
+// The 2x2 products of the blockwise inverse in SimdStorage.hpp, each with one fused multiply-add.
+
+CARAMELMATH_SIMD_TARGET("avx2,fma")
+inline __m128 multiply2x2Avx2(__m128 lhs, __m128 rhs) {
+	return _mm_fmadd_ps(
+		lhs,
+		shuffleAvx2<0, 3, 0, 3>(rhs, rhs),
+		_mm_mul_ps(shuffleAvx2<1, 0, 3, 2>(lhs, lhs), shuffleAvx2<2, 1, 2, 1>(rhs, rhs))
+		);
+}
+
+CARAMELMATH_SIMD_TARGET("avx2,fma")
+inline __m128 adjugateMultiply2x2Avx2(__m128 lhs, __m128 rhs) {
+	return _mm_fmsub_ps(
+		shuffleAvx2<3, 3, 0, 0>(lhs, lhs),
+		rhs,
+		_mm_mul_ps(shuffleAvx2<1, 1, 2, 2>(lhs, lhs), shuffleAvx2<2, 3, 0, 1>(rhs, rhs))
+		);
+}
+
+CARAMELMATH_SIMD_TARGET("avx2,fma")
+inline __m128 multiplyAdjugate2x2Avx2(__m128 lhs, __m128 rhs) {
+	return _mm_fmsub_ps(
+		lhs,
+		shuffleAvx2<3, 0, 3, 0>(rhs, rhs),
+		_mm_mul_ps(shuffleAvx2<1, 0, 3, 2>(lhs, lhs), shuffleAvx2<2, 1, 2, 1>(rhs, rhs))
+		);
+}
+
+// The blockwise inverse of detail::BlockDecomposition4x4 and detail::invert4x4, with the products of
+// 2x2 sub-determinants and adjugates fused.
+template <class MatrixType>
+CARAMELMATH_SIMD_TARGET("avx2,fma")
+std::optional<MatrixType> inverseAvx2(const MatrixType& matrix) {
+	const auto column0 = matrix.get(Column(0)).data();
+	const auto column1 = matrix.get(Column(1)).data();
+	const auto column2 = matrix.get(Column(2)).data();
+	const auto column3 = matrix.get(Column(3)).data();
+
+	const auto a = shuffleAvx2<0, 1, 0, 1>(column0, column1);
+	const auto b = shuffleAvx2<2, 3, 2, 3>(column0, column1);
+	const auto c = shuffleAvx2<0, 1, 0, 1>(column2, column3);
+	const auto d = shuffleAvx2<2, 3, 2, 3>(column2, column3);
+
+	const auto blockDeterminants = _mm_fmsub_ps(
+		shuffleAvx2<0, 2, 0, 2>(column0, column2),
+		shuffleAvx2<1, 3, 1, 3>(column1, column3),
+		_mm_mul_ps(shuffleAvx2<1, 3, 1, 3>(column0, column2), shuffleAvx2<0, 2, 0, 2>(column1, column3))
+		);
+	const auto detA = shuffleAvx2<0, 0, 0, 0>(blockDeterminants, blockDeterminants);
+	const auto detB = shuffleAvx2<1, 1, 1, 1>(blockDeterminants, blockDeterminants);
+	const auto detC = shuffleAvx2<2, 2, 2, 2>(blockDeterminants, blockDeterminants);
+	const auto detD = shuffleAvx2<3, 3, 3, 3>(blockDeterminants, blockDeterminants);
+
+	const auto adjugateAB = adjugateMultiply2x2Avx2(a, b);
+	const auto adjugateDC = adjugateMultiply2x2Avx2(d, c);
+
+	const auto traceTerms = _mm_mul_ps(adjugateAB, shuffleAvx2<0, 2, 1, 3>(adjugateDC, adjugateDC));
+	const auto tracePairs = _mm_add_ps(traceTerms, shuffleAvx2<1, 0, 3, 2>(traceTerms, traceTerms));
+	const auto trace = _mm_add_ps(tracePairs, shuffleAvx2<2, 3, 0, 1>(tracePairs, tracePairs));
+	const auto determinant = _mm_sub_ps(_mm_fmadd_ps(detA, detD, _mm_mul_ps(detB, detC)), trace);
+
+	if (_mm_cvtss_f32(determinant) == 0.0f) {
+		return std::nullopt;
+	}
+
+	const auto reciprocalDeterminant = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant);
+	const auto adjugateX = _mm_mul_ps(
+		_mm_fmsub_ps(detD, a, multiply2x2Avx2(b, adjugateDC)), reciprocalDeterminant);
+	const auto adjugateW = _mm_mul_ps(
+		_mm_fmsub_ps(detA, d, multiply2x2Avx2(c, adjugateAB)), reciprocalDeterminant);
+	const auto adjugateY = _mm_mul_ps(
+		_mm_fmsub_ps(detB, c, multiplyAdjugate2x2Avx2(d, adjugateAB)), reciprocalDeterminant);
+	const auto adjugateZ = _mm_mul_ps(
+		_mm_fmsub_ps(detC, b, multiplyAdjugate2x2Avx2(a, adjugateDC)), reciprocalDeterminant);
+
+	auto result = std::optional<MatrixType>(std::in_place);
+	result->set(Column(0), simd::Float4::fromData(shuffleAvx2<3, 1, 3, 1>(adjugateX, adjugateY)));
+	result->set(Column(1), simd::Float4::fromData(shuffleAvx2<2, 0, 2, 0>(adjugateX, adjugateY)));
+	result->set(Column(2), simd::Float4::fromData(shuffleAvx2<3, 1, 3, 1>(adjugateZ, adjugateW)));
+	result->set(Column(3), simd::Float4::fromData(shuffleAvx2<2, 0, 2, 0>(adjugateZ, adjugateW)));
+
+	return result;
+}
+
+#endif /* defined(CARAMELMATH_MATRIX_SIMD_DISPATCH_X86) */
+
+} // namespace detail
+
+// Kernels to use on a host supporting instructionSet. Tiers without dedicated kernels use those of the
+// best tier below them, down to the compile-time baseline (operator*).
+template <class MatrixType>
+[[nodiscard]] SimdKernels<MatrixType> simdKernels(simd::InstructionSet instructionSet) noexcept {
+	auto kernels = SimdKernels<MatrixType>{
+		&detail::multiplyBaseline<MatrixType>,
+		&detail::multiplyBatchBaseline<MatrixType>,
+		&detail::inverseBaseline<MatrixType>
+		};
+
+#if defined(CARAMELMATH_MATRIX_SIMD_DISPATCH_X86)
+	if constexpr (std::is_same_v<typename MatrixType::Scalar, float>) {
+		if (instructionSet >= simd::InstructionSet::AVX2) {
+			kernels.multiply = &detail::multiplyAvx2<MatrixType>;
+			kernels.multiplyBatch = &detail::multiplyBatchAvx2<MatrixType>;
+			kernels.inverse = &detail::inverseAvx2<MatrixType>;
+		}
+		if (instructionSet >= simd::InstructionSet::AVX512) {
+			kernels.multiplyBatch = &detail::multiplyBatchAvx512<MatrixType>;
+		}
+	}
+#else
+	static_cast<void>(instructionSet);
+#endif /* defined(CARAMELMATH_MATRIX_SIMD_DISPATCH_X86) */
+
+	return kernels;
+}
+
+// Kernels for simd::activeInstructionSet(). All tables are bound on first use, so changing the limit
+// with simd::limitInstructionSet takes effect immediately.
+template <class MatrixType>
+[[nodiscard]] const SimdKernels<MatrixType>& activeSimdKernels() noexcept {
+	static const auto TABLE = std::array<SimdKernels<MatrixType>, 5>{
+		simdKernels<MatrixType>(simd::InstructionSet::REFERENCE),
+		simdKernels<MatrixType>(simd::InstructionSet::SSE2),
+		simdKernels<MatrixType>(simd::InstructionSet::SSE4_1),
+		simdKernels<MatrixType>(simd::InstructionSet::AVX2),
+		simdKernels<MatrixType>(simd::InstructionSet::AVX512)
+		};
+	return TABLE[static_cast<size_t>(simd::activeInstructionSet())];
+}
+
+// Equivalent of lhs * rhs, using the best kernel available on this host.
+template <class ScalarTraitsType, class ErrorHandlerType>
+[[nodiscard]] inline Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>> multiply(
+	const Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>& lhs,
+	const Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>& rhs
+	)
+{
+	return activeSimdKernels<Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>>().multiply(lhs, rhs);
+}
+
+// Computes result[i] = lhs[i] * rhs[i] for i < count, using the best kernel available on this host.
+template <class ScalarTraitsType, class ErrorHandlerType>
+inline void multiplyBatch(
+	const Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>* lhs,
+	const Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>* rhs,
+	Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>* result,
+	size_t count
+	)
+{
+	activeSimdKernels<Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>>().multiplyBatch(lhs, rhs, result, count);
+}
+
+// Equivalent of inverse(matrix), using the best kernel available on this host.
+template <class ScalarTraitsType, class ErrorHandlerType>
+[[nodiscard]] inline std::optional<Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>> inverse(
+	const Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>& matrix
+	)
+{
+	return activeSimdKernels<Matrix<SimdStorage<ScalarTraitsType, ErrorHandlerType>>>().inverse(matrix);
+}
+
+} // namespace caramel_math::matrix::dispatch
+
+#endif /* CARAMELMATH_MATRIX_SIMDDISPATCH_HPP__ */
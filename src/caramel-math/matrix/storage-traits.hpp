@@ -2,6 +2,7 @@
 #define CARAMELMATH_MATRIX_STORAGETRAITS_HPP__
 
 #include <type_traits>
+#include <utility>
 
 #include "matrixfwd.hpp"
 
@@ -18,9 +19,36 @@ template <
 	class ScalarTraitsType,
 	size_t ROWS,
 	size_t COLUMNS,
-	class ErrorHandlerType
+	class ErrorHandlerType,
+	MajorOrder MAJOR_ORDER
 	>
-struct IsArrayStorage<ArrayStorage<ScalarTraitsType, ROWS, COLUMNS, ErrorHandlerType>> {
+struct IsArrayStorage<ArrayStorage<ScalarTraitsType, ROWS, COLUMNS, ErrorHandlerType, MAJOR_ORDER>> {
+	enum { VALUE = true };
+};
+
+template <class Type>
+struct IsMatrix {
+	enum { VALUE = false };
+};
+
+template <class StorageType>
+struct IsMatrix<Matrix<StorageType>> {
+	enum { VALUE = true };
+};
+
+// Lazy expressions built by lazy(), evaluated on conversion to a Matrix.
+template <class Type>
+struct IsMatrixExpression {
+	enum { VALUE = false };
+};
+
+template <class MatrixType, bool TRANSPOSED>
+struct IsMatrixExpression<MatrixReferenceExpression<MatrixType, TRANSPOSED>> {
+	enum { VALUE = true };
+};
+
+template <class LHSExpressionType, class RHSExpressionType>
+struct IsMatrixExpression<MatrixProductExpression<LHSExpressionType, RHSExpressionType>> {
 	enum { VALUE = true };
 };
 
@@ -37,6 +65,155 @@ struct IsAffineTransformStorage<AffineTransformStorage<ScalarTraitsType, ErrorHa
 	enum { VALUE = true };
 };
 
+// Storages providing transposeInPlace() let Matrix::transpose() skip the element-wise swaps.
+template <class StorageType, class = void>
+struct HasTransposeInPlace {
+	enum { VALUE = false };
+};
+
+template <class StorageType>
+struct HasTransposeInPlace<StorageType, std::void_t<decltype(std::declval<StorageType&>().transposeInPlace())>> {
+	enum { VALUE = true };
+};
+
+// Storages keeping their elements in a single array publish its layout: data() points to STORED_ELEMENTS
+// scalars, element (row, column) being data()[row * ROW_STRIDE + column * COLUMN_STRIDE], with MAJOR_ORDER telling
+// which stride is 1. Rows past the stored elements are implicit (e.g. the last row of an affine transform).
+// Generic algorithms run flat loops over such arrays instead of calling get() and set() per element. Storages opt
+// in by specializing this trait for their own type, so storages derived from them (e.g. to intercept set()) keep
+// going through get() and set() unless they opt in too.
+template <class StorageType, class = void>
+struct HasContiguousLayout {
+	enum { VALUE = false };
+};
+
+template <
+	class ScalarTraitsType,
+	size_t ROWS,
+	size_t COLUMNS,
+	class ErrorHandlerType,
+	MajorOrder MAJOR_ORDER
+	>
+struct HasContiguousLayout<ArrayStorage<ScalarTraitsType, ROWS, COLUMNS, ErrorHandlerType, MAJOR_ORDER>> {
+	enum { VALUE = true };
+};
+
+template <
+	class ScalarTraitsType,
+	class ErrorHandlerType
+	>
+struct HasContiguousLayout<AffineTransformStorage<ScalarTraitsType, ErrorHandlerType>> {
+	enum { VALUE = true };
+};
+
+template <
+	class ScalarTraitsType,
+	class ErrorHandlerType
+	>
+struct HasContiguousLayout<SimdStorage<ScalarTraitsType, ErrorHandlerType>> {
+	enum { VALUE = true };
+};
+
+// Contiguous layouts holding every element of the matrix.
+template <class StorageType, class = void>
+struct HasDenseLayout {
+	enum { VALUE = false };
+};
+
+template <class StorageType>
+struct HasDenseLayout<StorageType, std::enable_if_t<HasContiguousLayout<StorageType>::VALUE>> {
+	enum { VALUE = StorageType::STORED_ELEMENTS == StorageType::ROWS * StorageType::COLUMNS };
+};
+
+// Element i of one array corresponds to element i of the other, so the two can be walked by a single index.
+template <class LHSStorageType, class RHSStorageType, class = void>
+struct HaveSameContiguousLayout {
+	enum { VALUE = false };
+};
+
+template <class LHSStorageType, class RHSStorageType>
+struct HaveSameContiguousLayout<
+	LHSStorageType,
+	RHSStorageType,
+	std::enable_if_t<HasContiguousLayout<LHSStorageType>::VALUE && HasContiguousLayout<RHSStorageType>::VALUE>
+	>
+{
+	enum {
+		VALUE =
+			std::is_same_v<typename LHSStorageType::Scalar, typename RHSStorageType::Scalar> &&
+			LHSStorageType::ROWS == RHSStorageType::ROWS &&
+			LHSStorageType::COLUMNS == RHSStorageType::COLUMNS &&
+			LHSStorageType::ROW_STRIDE == RHSStorageType::ROW_STRIDE &&
+			LHSStorageType::COLUMN_STRIDE == RHSStorageType::COLUMN_STRIDE &&
+			LHSStorageType::STORED_ELEMENTS == RHSStorageType::STORED_ELEMENTS
+	};
+};
+
+template <class LHSStorageType, class RHSStorageType>
+struct HaveSameDenseLayout {
+	enum {
+		VALUE = HaveSameContiguousLayout<LHSStorageType, RHSStorageType>::VALUE && HasDenseLayout<LHSStorageType>::VALUE
+	};
+};
+
+// Element i of one array is the element of the other with row and column swapped, so a matrix is transposed into
+// the other storage by copying its array as it is.
+template <class LHSStorageType, class RHSStorageType, class = void>
+struct HaveTransposedDenseLayout {
+	enum { VALUE = false };
+};
+
+template <class LHSStorageType, class RHSStorageType>
+struct HaveTransposedDenseLayout<
+	LHSStorageType,
+	RHSStorageType,
+	std::enable_if_t<HasContiguousLayout<LHSStorageType>::VALUE && HasContiguousLayout<RHSStorageType>::VALUE>
+	>
+{
+	enum {
+		VALUE =
+			std::is_same_v<typename LHSStorageType::Scalar, typename RHSStorageType::Scalar> &&
+			LHSStorageType::ROWS == RHSStorageType::COLUMNS &&
+			LHSStorageType::COLUMNS == RHSStorageType::ROWS &&
+			LHSStorageType::ROW_STRIDE == RHSStorageType::COLUMN_STRIDE &&
+			LHSStorageType::COLUMN_STRIDE == RHSStorageType::ROW_STRIDE &&
+			HasDenseLayout<LHSStorageType>::VALUE &&
+			HasDenseLayout<RHSStorageType>::VALUE
+	};
+};
+
+// Storages converting from or to other storages themselves, e.g. through SIMD registers, provide
+// assignFrom(const SourceStorage&) or assignTo(TargetStorage&) respectively. Used by Matrix's converting assignment.
+template <class StorageType, class SourceStorageType, class = void>
+struct HasAssignFrom {
+	enum { VALUE = false };
+};
+
+template <class StorageType, class SourceStorageType>
+struct HasAssignFrom<
+	StorageType,
+	SourceStorageType,
+	std::void_t<decltype(std::declval<StorageType&>().assignFrom(std::declval<const SourceStorageType&>()))>
+	>
+{
+	enum { VALUE = true };
+};
+
+template <class StorageType, class TargetStorageType, class = void>
+struct HasAssignTo {
+	enum { VALUE = false };
+};
+
+template <class StorageType, class TargetStorageType>
+struct HasAssignTo<
+	StorageType,
+	TargetStorageType,
+	std::void_t<decltype(std::declval<const StorageType&>().assignTo(std::declval<TargetStorageType&>()))>
+	>
+{
+	enum { VALUE = true };
+};
+
 template <class StorageType>
 struct EffectiveStorageType {
 	using Type = StorageType;
@@ -58,7 +235,8 @@ struct TransposedStorageType<
 	StorageType,
 	std::enable_if_t<
 		StorageType::ROWS == StorageType::COLUMNS &&
-		!IsAffineTransformStorage<StorageType>::VALUE
+		!IsAffineTransformStorage<StorageType>::VALUE &&
+		!IsArrayStorage<StorageType>::VALUE
 		>
 	>
 {
@@ -69,8 +247,8 @@ template <class StorageType>
 struct TransposedStorageType<
 	StorageType,
 	std::enable_if_t<
-		StorageType::ROWS != StorageType::COLUMNS ||
-		IsAffineTransformStorage<StorageType>::VALUE
+		(StorageType::ROWS != StorageType::COLUMNS || IsAffineTransformStorage<StorageType>::VALUE) &&
+		!IsArrayStorage<StorageType>::VALUE
 		>
 	>
 {
@@ -83,6 +261,25 @@ struct TransposedStorageType<
 		;
 };
 
+// ArrayStorage flips its major order, so the transposed matrix keeps the elements where they are.
+template <
+	class ScalarTraitsType,
+	size_t ROWS,
+	size_t COLUMNS,
+	class ErrorHandlerType,
+	MajorOrder MAJOR_ORDER
+	>
+struct TransposedStorageType<ArrayStorage<ScalarTraitsType, ROWS, COLUMNS, ErrorHandlerType, MAJOR_ORDER>> {
+	using Type = ArrayStorage<
+		ScalarTraitsType,
+		COLUMNS,
+		ROWS,
+		ErrorHandlerType,
+		(MAJOR_ORDER == MajorOrder::ROW) ? MajorOrder::COLUMN : MajorOrder::ROW
+		>
+		;
+};
+
 template <class LHSStorageType, class RHSStorageType, size_t ROWS, size_t COLUMNS, class = void>
 struct BinaryOperatorResultType;
 
@@ -99,21 +296,22 @@ template <
 	size_t LHS_ROWS,
 	size_t LHS_COLUMNS,
 	class LHSErrorHandlerType,
+	MajorOrder LHS_MAJOR_ORDER,
 	class RHSStorageType,
 	size_t ROWS,
 	size_t COLUMNS
 	>
 struct BinaryOperatorResultType<
-	ArrayStorage<LHSScalarTraitsType, LHS_ROWS, LHS_COLUMNS, LHSErrorHandlerType>,
+	ArrayStorage<LHSScalarTraitsType, LHS_ROWS, LHS_COLUMNS, LHSErrorHandlerType, LHS_MAJOR_ORDER>,
 	RHSStorageType,
 	ROWS,
 	COLUMNS,
 	std::enable_if_t<
-		!std::is_same_v<ArrayStorage<LHSScalarTraitsType, LHS_ROWS, LHS_COLUMNS, LHSErrorHandlerType>, RHSStorageType>
+		!std::is_same_v<ArrayStorage<LHSScalarTraitsType, LHS_ROWS, LHS_COLUMNS, LHSErrorHandlerType, LHS_MAJOR_ORDER>, RHSStorageType>
 		>
 	>
 {
-	using Type = ArrayStorage<LHSScalarTraitsType, ROWS, COLUMNS, LHSErrorHandlerType>;
+	using Type = ArrayStorage<LHSScalarTraitsType, ROWS, COLUMNS, LHSErrorHandlerType, LHS_MAJOR_ORDER>;
 };
 
 template <
@@ -122,21 +320,40 @@ template <
 	size_t RHS_ROWS,
 	size_t RHS_COLUMNS,
 	class RHSErrorHandlerType,
+	MajorOrder RHS_MAJOR_ORDER,
 	size_t ROWS,
 	size_t COLUMNS
 	>
 struct BinaryOperatorResultType<
 	LHSStorageType,
-	ArrayStorage<RHSScalarTraitsType, RHS_ROWS, RHS_COLUMNS, RHSErrorHandlerType>,
+	ArrayStorage<RHSScalarTraitsType, RHS_ROWS, RHS_COLUMNS, RHSErrorHandlerType, RHS_MAJOR_ORDER>,
 	ROWS,
 	COLUMNS,
 	std::enable_if_t<
 		!IsArrayStorage<LHSStorageType>::VALUE &&
-		!std::is_same_v<LHSStorageType, ArrayStorage<RHSScalarTraitsType, RHS_ROWS, RHS_COLUMNS, RHSErrorHandlerType>>
+		!std::is_same_v<LHSStorageType, ArrayStorage<RHSScalarTraitsType, RHS_ROWS, RHS_COLUMNS, RHSErrorHandlerType, RHS_MAJOR_ORDER>>
 		>
 	>
 {
-	using Type = ArrayStorage<RHSScalarTraitsType, ROWS, COLUMNS, RHSErrorHandlerType>;
+	using Type = ArrayStorage<RHSScalarTraitsType, ROWS, COLUMNS, RHSErrorHandlerType, RHS_MAJOR_ORDER>;
+};
+
+// Element-wise sums, differences and negations of affine transforms don't keep the constant last row, so they
+// are stored in full.
+template <class StorageType, class = void>
+struct ElementWiseResultType {
+	using Type = StorageType;
+};
+
+template <class StorageType>
+struct ElementWiseResultType<StorageType, std::enable_if_t<IsAffineTransformStorage<StorageType>::VALUE>> {
+	using Type = ArrayStorage<
+		typename StorageType::ScalarTraits,
+		StorageType::ROWS,
+		StorageType::COLUMNS,
+		typename StorageType::ErrorHandler
+		>
+		;
 };
 
 } // namespace detail
@@ -155,6 +372,11 @@ using BinaryOperatorResultType = typename detail::BinaryOperatorResultType<
 	COLUMNS
 	>::Type;
 
+template <class LHSStorageType, class RHSStorageType>
+using ElementWiseResultType = typename detail::ElementWiseResultType<
+	BinaryOperatorResultType<LHSStorageType, RHSStorageType, LHSStorageType::ROWS, LHSStorageType::COLUMNS>
+	>::Type;
+
 } // namespace caramel_math::matrix
 
 #endif /* CARAMELMATH_MATRIX_STORAGETRAITS_HPP__ */
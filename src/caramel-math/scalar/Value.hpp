@@ -1,6 +1,8 @@
 #pragma once
 
-#include <iosfwd>
+#include <ostream>
+#include <typeinfo>
+#include <utility>
 
 namespace caramel_math::scalar {
 
@@ -10,7 +12,7 @@ public:
 
 	constexpr Value() = default;
 
-	constexpr explicit Value(ScalarType value) :
+	constexpr explicit Value(ScalarType value) noexcept :
 		value_(std::move(value))
 	{
 	}
@@ -120,7 +122,7 @@ public:
 
 private:
 
-	ScalarType value_;
+	ScalarType value_ = ScalarType();
 
 };
 
@@ -0,0 +1,53 @@
+#ifndef CARAMELMATH_SCALAR_ULPDISTANCE_HPP__
+#define CARAMELMATH_SCALAR_ULPDISTANCE_HPP__
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace caramel_math::scalar {
+
+namespace detail {
+
+inline std::int64_t orderedBits(float value) noexcept {
+	auto bits = std::int32_t();
+	std::memcpy(&bits, &value, sizeof(bits));
+	return (bits < 0) ? -std::int64_t(bits & std::numeric_limits<std::int32_t>::max()) : std::int64_t(bits);
+}
+
+inline std::int64_t orderedBits(double value) noexcept {
+	auto bits = std::int64_t();
+	std::memcpy(&bits, &value, sizeof(bits));
+	return (bits < 0) ? -(bits & std::numeric_limits<std::int64_t>::max()) : bits;
+}
+
+} // namespace detail
+
+// Number of representable floats between lhs and rhs. Yields 0 for bit-identical values, including
+// matching NaNs, and the maximum value if exactly one of the operands is a NaN.
+inline std::uint32_t ulpDistance(float lhs, float rhs) noexcept {
+	if (std::isnan(lhs) || std::isnan(rhs)) {
+		return (std::isnan(lhs) && std::isnan(rhs)) ? 0u : std::numeric_limits<std::uint32_t>::max();
+	}
+
+	const auto difference = detail::orderedBits(lhs) - detail::orderedBits(rhs);
+	return static_cast<std::uint32_t>(difference < 0 ? -difference : difference);
+}
+
+// Number of representable doubles between lhs and rhs, see ulpDistance(float, float).
+inline std::uint64_t ulpDistance(double lhs, double rhs) noexcept {
+	if (std::isnan(lhs) || std::isnan(rhs)) {
+		return (std::isnan(lhs) && std::isnan(rhs)) ? 0u : std::numeric_limits<std::uint64_t>::max();
+	}
+
+	const auto lhsBits = detail::orderedBits(lhs);
+	const auto rhsBits = detail::orderedBits(rhs);
+	return (lhsBits < rhsBits)
+		? static_cast<std::uint64_t>(rhsBits) - static_cast<std::uint64_t>(lhsBits)
+		: static_cast<std::uint64_t>(lhsBits) - static_cast<std::uint64_t>(rhsBits);
+}
+
+} // namespace caramel_math::scalar
+
+#endif /* CARAMELMATH_SCALAR_ULPDISTANCE_HPP__ */
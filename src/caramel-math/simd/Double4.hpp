@@ -0,0 +1,402 @@
+#ifndef CARAMELMATH_SIMD_DOUBLE4_HPP__
+#define CARAMELMATH_SIMD_DOUBLE4_HPP__
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "detail/instruction-sets.hpp"
+#include "detail/ReferenceDouble4.hpp"
+#include "Float4.hpp"
+
+#if !defined(CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION)
+#	if defined(CARAMELMATH_SIMD_AVX)
+#		include "detail/AvxDouble4.hpp"
+#	elif defined(CARAMELMATH_SIMD_SSE2)
+#		include "detail/Sse2Double4.hpp"
+#	endif
+#endif /* !defined(CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION) */
+
+namespace caramel_math::simd {
+
+namespace detail {
+
+#if !defined(CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION) && defined(CARAMELMATH_SIMD_AVX)
+using NativeDouble4 = AvxDouble4;
+#elif !defined(CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION) && defined(CARAMELMATH_SIMD_SSE2)
+using NativeDouble4 = Sse2Double4;
+#else
+using NativeDouble4 = ReferenceDouble4;
+#endif /* !defined(CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION) && defined(CARAMELMATH_SIMD_AVX) */
+
+} // namespace detail
+
+// Result of a lane-wise comparison of two BasicDouble4s.
+template <class ImplementationType>
+class BasicDouble4Mask {
+public:
+
+	using Implementation = ImplementationType;
+
+	using Data = typename Implementation::Mask;
+
+	BasicDouble4Mask() = default;
+
+	friend BasicDouble4Mask operator&(const BasicDouble4Mask& lhs, const BasicDouble4Mask& rhs) noexcept {
+		return fromData(Implementation::maskAnd(lhs.data_, rhs.data_));
+	}
+
+	BasicDouble4Mask& operator&=(const BasicDouble4Mask& other) noexcept {
+		data_ = (*this & other).data_;
+		return *this;
+	}
+
+	friend BasicDouble4Mask operator|(const BasicDouble4Mask& lhs, const BasicDouble4Mask& rhs) noexcept {
+		return fromData(Implementation::maskOr(lhs.data_, rhs.data_));
+	}
+
+	BasicDouble4Mask& operator|=(const BasicDouble4Mask& other) noexcept {
+		data_ = (*this | other).data_;
+		return *this;
+	}
+
+	static BasicDouble4Mask fromData(Data data) noexcept {
+		auto result = BasicDouble4Mask();
+		result.data_ = std::move(data);
+		return result;
+	}
+
+	const Data& data() const noexcept {
+		return data_;
+	}
+
+private:
+
+	Data data_;
+
+};
+
+// Four double lanes, with the operations of BasicFloat4 except for the reciprocal estimates, which SSE and
+// AVX only provide for floats.
+template <class ImplementationType>
+class BasicDouble4 {
+public:
+
+	using Implementation = ImplementationType;
+
+	using Data = typename Implementation::Data;
+
+	// Alignment required by loadAligned, storeAligned and streamStore: 32 bytes with AVX, 16 otherwise.
+	static constexpr auto ALIGNMENT = alignof(Data);
+
+	static_assert(ALIGNMENT >= 16, "Double4 data expected to be at least 16-byte aligned");
+
+	BasicDouble4() = default;
+
+	explicit BasicDouble4(double d) noexcept {
+		data_ = Implementation::replicate(d);
+	}
+
+	// xyzw may live anywhere, e.g. in a packed struct, so no alignment is assumed.
+	explicit BasicDouble4(const std::array<double, 4>& xyzw) noexcept {
+		data_ = Implementation::loadUnaligned(xyzw.data());
+	}
+
+	std::array<double, 4> xyzw() const noexcept {
+		auto data = std::array<double, 4>();
+		Implementation::storeUnaligned(data.data(), data_);
+		return data;
+	}
+
+	static BasicDouble4 loadAligned(const double* xyzw) noexcept {
+		assert(isAligned_(xyzw));
+		return fromData(Implementation::load(xyzw));
+	}
+
+	static BasicDouble4 loadUnaligned(const double* xyzw) noexcept {
+		return fromData(Implementation::loadUnaligned(xyzw));
+	}
+
+	void storeAligned(double* xyzw) const noexcept {
+		assert(isAligned_(xyzw));
+		Implementation::store(xyzw, data_);
+	}
+
+	void storeUnaligned(double* xyzw) const noexcept {
+		Implementation::storeUnaligned(xyzw, data_);
+	}
+
+	// Non-temporal store, see BasicFloat4::streamStore.
+	void streamStore(double* xyzw) const noexcept {
+		assert(isAligned_(xyzw));
+		Implementation::streamStore(xyzw, data_);
+	}
+
+	friend BasicDouble4 operator+(const BasicDouble4& lhs, const BasicDouble4& rhs) noexcept {
+		auto result = BasicDouble4();
+		result.data_ = Implementation::add(lhs.data_, rhs.data_);
+		return result;
+	}
+
+	BasicDouble4& operator+=(const BasicDouble4& other) noexcept {
+		data_ = (*this + other).data_;
+		return *this;
+	}
+
+	friend BasicDouble4 operator-(const BasicDouble4& lhs, const BasicDouble4& rhs) noexcept {
+		auto result = BasicDouble4();
+		result.data_ = Implementation::subtract(lhs.data_, rhs.data_);
+		return result;
+	}
+
+	BasicDouble4& operator-=(const BasicDouble4& other) noexcept {
+		data_ = (*this - other).data_;
+		return *this;
+	}
+
+	friend BasicDouble4 operator*(const BasicDouble4& lhs, const BasicDouble4& rhs) noexcept {
+		auto result = BasicDouble4();
+		result.data_ = Implementation::multiply(lhs.data_, rhs.data_);
+		return result;
+	}
+
+	BasicDouble4& operator*=(const BasicDouble4& other) noexcept {
+		data_ = (*this * other).data_;
+		return *this;
+	}
+
+	friend BasicDouble4 operator/(const BasicDouble4& lhs, const BasicDouble4& rhs) noexcept {
+		auto result = BasicDouble4();
+		result.data_ = Implementation::divide(lhs.data_, rhs.data_);
+		return result;
+	}
+
+	BasicDouble4& operator/=(const BasicDouble4& other) noexcept {
+		data_ = (*this / other).data_;
+		return *this;
+	}
+
+	// Returns { lane X, lane Y, lane Z, lane W } of this, without leaving the register.
+	template <size_t X, size_t Y, size_t Z, size_t W>
+	BasicDouble4 shuffle() const noexcept {
+		static_assert(X < 4 && Y < 4 && Z < 4 && W < 4, "Invalid lane index");
+		auto result = BasicDouble4();
+		result.data_ = Implementation::template shuffle<X, Y, Z, W>(data_);
+		return result;
+	}
+
+	template <size_t LANE>
+	BasicDouble4 broadcastLane() const noexcept {
+		return shuffle<LANE, LANE, LANE, LANE>();
+	}
+
+	template <size_t LANE>
+	double extractLane() const noexcept {
+		static_assert(LANE < 4, "Invalid lane index");
+		return Implementation::template extractLane<LANE>(data_);
+	}
+
+	// Returns a copy with lane LANE replaced by value, without a round trip through memory.
+	template <size_t LANE>
+	BasicDouble4 insertLane(double value) const noexcept {
+		static_assert(LANE < 4, "Invalid lane index");
+		return fromData(Implementation::template insertLane<LANE>(data_, value));
+	}
+
+	// Wraps implementation specific data, e.g. an __m256d obtained from intrinsics.
+	static BasicDouble4 fromData(Data data) noexcept {
+		auto result = BasicDouble4();
+		result.data_ = std::move(data);
+		return result;
+	}
+
+	const Data& data() const noexcept {
+		return data_;
+	}
+
+private:
+
+	Data data_;
+
+	static bool isAligned_(const double* xyzw) noexcept {
+		return reinterpret_cast<std::uintptr_t>(xyzw) % ALIGNMENT == 0;
+	}
+
+};
+
+// -- lane-wise math
+
+// Returns lhs * rhs + addend, fused where FMA3 is available, see the BasicFloat4 overload.
+template <class ImplementationType>
+inline BasicDouble4<ImplementationType> madd(
+	const BasicDouble4<ImplementationType>& lhs,
+	const BasicDouble4<ImplementationType>& rhs,
+	const BasicDouble4<ImplementationType>& addend
+	) noexcept
+{
+	const auto data = ImplementationType::multiplyAdd(lhs.data(), rhs.data(), addend.data());
+	return BasicDouble4<ImplementationType>::fromData(data);
+}
+
+template <class ImplementationType>
+inline BasicDouble4<ImplementationType> min(
+	const BasicDouble4<ImplementationType>& lhs,
+	const BasicDouble4<ImplementationType>& rhs
+	) noexcept
+{
+	return BasicDouble4<ImplementationType>::fromData(ImplementationType::min(lhs.data(), rhs.data()));
+}
+
+template <class ImplementationType>
+inline BasicDouble4<ImplementationType> max(
+	const BasicDouble4<ImplementationType>& lhs,
+	const BasicDouble4<ImplementationType>& rhs
+	) noexcept
+{
+	return BasicDouble4<ImplementationType>::fromData(ImplementationType::max(lhs.data(), rhs.data()));
+}
+
+template <class ImplementationType>
+inline BasicDouble4<ImplementationType> abs(const BasicDouble4<ImplementationType>& d4) noexcept {
+	return BasicDouble4<ImplementationType>::fromData(ImplementationType::abs(d4.data()));
+}
+
+template <class ImplementationType>
+inline BasicDouble4<ImplementationType> sqrt(const BasicDouble4<ImplementationType>& d4) noexcept {
+	return BasicDouble4<ImplementationType>::fromData(ImplementationType::sqrt(d4.data()));
+}
+
+// Exact 1 / d4.
+template <class ImplementationType>
+inline BasicDouble4<ImplementationType> rcp(const BasicDouble4<ImplementationType>& d4) noexcept {
+	return BasicDouble4<ImplementationType>(1.0) / d4;
+}
+
+// Exact 1 / sqrt(d4).
+template <class ImplementationType>
+inline BasicDouble4<ImplementationType> rsqrt(const BasicDouble4<ImplementationType>& d4) noexcept {
+	return BasicDouble4<ImplementationType>(1.0) / sqrt(d4);
+}
+
+// -- comparisons and masks
+
+template <class ImplementationType>
+inline BasicDouble4Mask<ImplementationType> cmpLt(
+	const BasicDouble4<ImplementationType>& lhs,
+	const BasicDouble4<ImplementationType>& rhs
+	) noexcept
+{
+	return BasicDouble4Mask<ImplementationType>::fromData(ImplementationType::lessThan(lhs.data(), rhs.data()));
+}
+
+template <class ImplementationType>
+inline BasicDouble4Mask<ImplementationType> cmpLe(
+	const BasicDouble4<ImplementationType>& lhs,
+	const BasicDouble4<ImplementationType>& rhs
+	) noexcept
+{
+	return BasicDouble4Mask<ImplementationType>::fromData(ImplementationType::lessEqual(lhs.data(), rhs.data()));
+}
+
+template <class ImplementationType>
+inline BasicDouble4Mask<ImplementationType> cmpEq(
+	const BasicDouble4<ImplementationType>& lhs,
+	const BasicDouble4<ImplementationType>& rhs
+	) noexcept
+{
+	return BasicDouble4Mask<ImplementationType>::fromData(ImplementationType::equal(lhs.data(), rhs.data()));
+}
+
+// Returns ifTrue in lanes where mask is set and ifFalse elsewhere, without branching.
+template <class ImplementationType>
+inline BasicDouble4<ImplementationType> select(
+	const BasicDouble4Mask<ImplementationType>& mask,
+	const BasicDouble4<ImplementationType>& ifTrue,
+	const BasicDouble4<ImplementationType>& ifFalse
+	) noexcept
+{
+	const auto data = ImplementationType::select(mask.data(), ifTrue.data(), ifFalse.data());
+	return BasicDouble4<ImplementationType>::fromData(data);
+}
+
+// Returns a bit set with bit i set iff lane i of mask is set.
+template <class ImplementationType>
+inline int movemask(const BasicDouble4Mask<ImplementationType>& mask) noexcept {
+	return ImplementationType::moveMask(mask.data());
+}
+
+template <class ImplementationType>
+inline bool all(const BasicDouble4Mask<ImplementationType>& mask) noexcept {
+	return movemask(mask) == 0xf;
+}
+
+template <class ImplementationType>
+inline bool any(const BasicDouble4Mask<ImplementationType>& mask) noexcept {
+	return movemask(mask) != 0;
+}
+
+// -- horizontal operations, each yielding its result replicated across all lanes
+
+template <class ImplementationType>
+inline BasicDouble4<ImplementationType> horizontalAdd(const BasicDouble4<ImplementationType>& d4) noexcept {
+	const auto pairs = d4 + d4.template shuffle<1, 0, 3, 2>();
+	return pairs + pairs.template shuffle<2, 3, 0, 1>();
+}
+
+template <class ImplementationType>
+inline BasicDouble4<ImplementationType> horizontalMin(const BasicDouble4<ImplementationType>& d4) noexcept {
+	const auto pairs = min(d4, d4.template shuffle<1, 0, 3, 2>());
+	return min(pairs, pairs.template shuffle<2, 3, 0, 1>());
+}
+
+template <class ImplementationType>
+inline BasicDouble4<ImplementationType> horizontalMax(const BasicDouble4<ImplementationType>& d4) noexcept {
+	const auto pairs = max(d4, d4.template shuffle<1, 0, 3, 2>());
+	return max(pairs, pairs.template shuffle<2, 3, 0, 1>());
+}
+
+template <class ImplementationType>
+inline BasicDouble4<ImplementationType> dot(
+	const BasicDouble4<ImplementationType>& lhs,
+	const BasicDouble4<ImplementationType>& rhs
+	) noexcept
+{
+	return horizontalAdd(lhs * rhs);
+}
+
+// Transposes the 4x4 matrix with columns (or rows) c0 to c3 in place.
+template <class ImplementationType>
+inline void transpose(
+	BasicDouble4<ImplementationType>& c0,
+	BasicDouble4<ImplementationType>& c1,
+	BasicDouble4<ImplementationType>& c2,
+	BasicDouble4<ImplementationType>& c3
+	) noexcept
+{
+	auto data0 = c0.data();
+	auto data1 = c1.data();
+	auto data2 = c2.data();
+	auto data3 = c3.data();
+	ImplementationType::transpose(data0, data1, data2, data3);
+	c0 = BasicDouble4<ImplementationType>::fromData(data0);
+	c1 = BasicDouble4<ImplementationType>::fromData(data1);
+	c2 = BasicDouble4<ImplementationType>::fromData(data2);
+	c3 = BasicDouble4<ImplementationType>::fromData(data3);
+}
+
+// Double4 backed by AVX where the target supports it, SSE2 otherwise and the portable implementation
+// on other architectures. Define CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION to force the portable one.
+using Double4 = BasicDouble4<detail::NativeDouble4>;
+
+using Double4Mask = BasicDouble4Mask<detail::NativeDouble4>;
+
+// Double4 backed by the portable implementation, regardless of the target.
+using ReferenceDouble4 = BasicDouble4<detail::ReferenceDouble4>;
+
+using ReferenceDouble4Mask = BasicDouble4Mask<detail::ReferenceDouble4>;
+
+} // namespace caramel_math::simd
+
+#endif /* CARAMELMATH_SIMD_DOUBLE4_HPP__ */
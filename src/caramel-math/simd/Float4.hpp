@@ -2,80 +2,443 @@
 #define CARAMELMATH_SIMD_FLOAT4_HPP__
 
 #include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
 
-#include "detail/VisualCppFloat4.hpp"
+#include "detail/ReferenceFloat4.hpp"
+
+#if !defined(CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION)
+#	if defined(_MSC_VER) || defined(__SSE__)
+#		include "detail/SseFloat4.hpp"
+#	else
+#		define CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION
+#	endif
+#endif /* !defined(CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION) */
 
 namespace caramel_math::simd {
 
-class Float4 {
+namespace detail {
+
+#if defined(CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION)
+using NativeFloat4 = ReferenceFloat4;
+#else
+using NativeFloat4 = SseFloat4;
+#endif /* defined(CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION) */
+
+} // namespace detail
+
+// Result of a lane-wise comparison of two BasicFloat4s.
+template <class ImplementationType>
+class BasicFloat4Mask {
+public:
+
+	using Implementation = ImplementationType;
+
+	using Data = typename Implementation::Mask;
+
+	BasicFloat4Mask() = default;
+
+	friend BasicFloat4Mask operator&(const BasicFloat4Mask& lhs, const BasicFloat4Mask& rhs) noexcept {
+		return fromData(Implementation::maskAnd(lhs.data_, rhs.data_));
+	}
+
+	BasicFloat4Mask& operator&=(const BasicFloat4Mask& other) noexcept {
+		data_ = (*this & other).data_;
+		return *this;
+	}
+
+	friend BasicFloat4Mask operator|(const BasicFloat4Mask& lhs, const BasicFloat4Mask& rhs) noexcept {
+		return fromData(Implementation::maskOr(lhs.data_, rhs.data_));
+	}
+
+	BasicFloat4Mask& operator|=(const BasicFloat4Mask& other) noexcept {
+		data_ = (*this | other).data_;
+		return *this;
+	}
+
+	static BasicFloat4Mask fromData(Data data) noexcept {
+		auto result = BasicFloat4Mask();
+		result.data_ = std::move(data);
+		return result;
+	}
+
+	const Data& data() const noexcept {
+		return data_;
+	}
+
+private:
+
+	Data data_;
+
+};
+
+template <class ImplementationType>
+class BasicFloat4 {
 public:
 
-	Float4() = default;
+	using Implementation = ImplementationType;
 
-	explicit Float4(float f) noexcept {
-		data_ = detail::replicate(f);
+	using Data = typename Implementation::Data;
+
+	// Alignment required by loadAligned, storeAligned and streamStore.
+	static constexpr auto ALIGNMENT = alignof(Data);
+
+	static_assert(ALIGNMENT >= 16, "Float4 data expected to be 16-byte aligned");
+
+	BasicFloat4() = default;
+
+	explicit BasicFloat4(float f) noexcept {
+		data_ = Implementation::replicate(f);
 	}
 
-	explicit Float4(const std::array<float, 4>& xyzw) noexcept {
-		data_ = detail::load(xyzw.data());
+	// xyzw may live anywhere, e.g. in a packed struct, so no alignment is assumed.
+	explicit BasicFloat4(const std::array<float, 4>& xyzw) noexcept {
+		data_ = Implementation::loadUnaligned(xyzw.data());
 	}
 
 	std::array<float, 4> xyzw() const noexcept {
 		auto data = std::array<float, 4>();
-		detail::store(data.data(), data_);
-		return std::move(data);
+		Implementation::storeUnaligned(data.data(), data_);
+		return data;
+	}
+
+	static BasicFloat4 loadAligned(const float* xyzw) noexcept {
+		assert(isAligned_(xyzw));
+		return fromData(Implementation::load(xyzw));
 	}
 
-	friend Float4 operator+(const Float4& lhs, const Float4& rhs) noexcept {
-		auto result = Float4();
-		result.data_ = detail::add(lhs.data_, rhs.data_);
+	static BasicFloat4 loadUnaligned(const float* xyzw) noexcept {
+		return fromData(Implementation::loadUnaligned(xyzw));
+	}
+
+	void storeAligned(float* xyzw) const noexcept {
+		assert(isAligned_(xyzw));
+		Implementation::store(xyzw, data_);
+	}
+
+	void storeUnaligned(float* xyzw) const noexcept {
+		Implementation::storeUnaligned(xyzw, data_);
+	}
+
+	// Non-temporal store, bypassing the cache. Meant for bulk writes of data that will not be read back
+	// soon, e.g. to upload buffers. xyzw must be aligned and streamFence() must be called before the data
+	// is consumed elsewhere.
+	void streamStore(float* xyzw) const noexcept {
+		assert(isAligned_(xyzw));
+		Implementation::streamStore(xyzw, data_);
+	}
+
+	friend BasicFloat4 operator+(const BasicFloat4& lhs, const BasicFloat4& rhs) noexcept {
+		auto result = BasicFloat4();
+		result.data_ = Implementation::add(lhs.data_, rhs.data_);
 		return result;
 	}
 
-	Float4& operator+=(const Float4& other) noexcept {
+	BasicFloat4& operator+=(const BasicFloat4& other) noexcept {
 		data_ = (*this + other).data_;
 		return *this;
 	}
 
-	friend Float4 operator-(const Float4& lhs, const Float4& rhs) noexcept {
-		auto result = Float4();
-		result.data_ = detail::subtract(lhs.data_, rhs.data_);
+	friend BasicFloat4 operator-(const BasicFloat4& lhs, const BasicFloat4& rhs) noexcept {
+		auto result = BasicFloat4();
+		result.data_ = Implementation::subtract(lhs.data_, rhs.data_);
 		return result;
 	}
 
-	Float4& operator-=(const Float4& other) noexcept {
+	BasicFloat4& operator-=(const BasicFloat4& other) noexcept {
 		data_ = (*this - other).data_;
 		return *this;
 	}
 
-	friend Float4 operator*(const Float4& lhs, const Float4& rhs) noexcept {
-		auto result = Float4();
-		result.data_ = detail::multiply(lhs.data_, rhs.data_);
+	friend BasicFloat4 operator*(const BasicFloat4& lhs, const BasicFloat4& rhs) noexcept {
+		auto result = BasicFloat4();
+		result.data_ = Implementation::multiply(lhs.data_, rhs.data_);
 		return result;
 	}
 
-	Float4& operator*=(const Float4& other) noexcept {
+	BasicFloat4& operator*=(const BasicFloat4& other) noexcept {
 		data_ = (*this * other).data_;
 		return *this;
 	}
 
-	friend Float4 operator/(const Float4& lhs, const Float4& rhs) noexcept {
-		auto result = Float4();
-		result.data_ = detail::divide(lhs.data_, rhs.data_);
+	friend BasicFloat4 operator/(const BasicFloat4& lhs, const BasicFloat4& rhs) noexcept {
+		auto result = BasicFloat4();
+		result.data_ = Implementation::divide(lhs.data_, rhs.data_);
 		return result;
 	}
 
-	Float4& operator/=(const Float4& other) noexcept {
+	BasicFloat4& operator/=(const BasicFloat4& other) noexcept {
 		data_ = (*this / other).data_;
 		return *this;
 	}
 
+	// Returns { lane X, lane Y, lane Z, lane W } of this, without leaving the register.
+	template <size_t X, size_t Y, size_t Z, size_t W>
+	BasicFloat4 shuffle() const noexcept {
+		static_assert(X < 4 && Y < 4 && Z < 4 && W < 4, "Invalid lane index");
+		auto result = BasicFloat4();
+		result.data_ = Implementation::template shuffle<X, Y, Z, W>(data_);
+		return result;
+	}
+
+	template <size_t LANE>
+	BasicFloat4 broadcastLane() const noexcept {
+		return shuffle<LANE, LANE, LANE, LANE>();
+	}
+
+	template <size_t LANE>
+	float extractLane() const noexcept {
+		static_assert(LANE < 4, "Invalid lane index");
+		return Implementation::template extractLane<LANE>(data_);
+	}
+
+	// Returns a copy with lane LANE replaced by value, without a round trip through memory.
+	template <size_t LANE>
+	BasicFloat4 insertLane(float value) const noexcept {
+		static_assert(LANE < 4, "Invalid lane index");
+		return fromData(Implementation::template insertLane<LANE>(data_, value));
+	}
+
+	// Wraps implementation specific data, e.g. an __m128 obtained from intrinsics.
+	static BasicFloat4 fromData(Data data) noexcept {
+		auto result = BasicFloat4();
+		result.data_ = std::move(data);
+		return result;
+	}
+
+	const Data& data() const noexcept {
+		return data_;
+	}
+
 private:
 
-	detail::Float4 data_;
+	Data data_;
+
+	static bool isAligned_(const float* xyzw) noexcept {
+		return reinterpret_cast<std::uintptr_t>(xyzw) % ALIGNMENT == 0;
+	}
 
 };
 
+// Orders preceding streamStore calls before any subsequent stores.
+template <class ImplementationType>
+inline void streamFence() noexcept {
+	ImplementationType::streamFence();
+}
+
+inline void streamFence() noexcept {
+	streamFence<detail::NativeFloat4>();
+}
+
+// -- lane-wise math
+
+// Returns lhs * rhs + addend. Compiles to a single fused multiply-add, rounding once, where FMA3 is
+// available.
+template <class ImplementationType>
+inline BasicFloat4<ImplementationType> madd(
+	const BasicFloat4<ImplementationType>& lhs,
+	const BasicFloat4<ImplementationType>& rhs,
+	const BasicFloat4<ImplementationType>& addend
+	) noexcept
+{
+	const auto data = ImplementationType::multiplyAdd(lhs.data(), rhs.data(), addend.data());
+	return BasicFloat4<ImplementationType>::fromData(data);
+}
+
+template <class ImplementationType>
+inline BasicFloat4<ImplementationType> min(
+	const BasicFloat4<ImplementationType>& lhs,
+	const BasicFloat4<ImplementationType>& rhs
+	) noexcept
+{
+	return BasicFloat4<ImplementationType>::fromData(ImplementationType::min(lhs.data(), rhs.data()));
+}
+
+template <class ImplementationType>
+inline BasicFloat4<ImplementationType> max(
+	const BasicFloat4<ImplementationType>& lhs,
+	const BasicFloat4<ImplementationType>& rhs
+	) noexcept
+{
+	return BasicFloat4<ImplementationType>::fromData(ImplementationType::max(lhs.data(), rhs.data()));
+}
+
+template <class ImplementationType>
+inline BasicFloat4<ImplementationType> abs(const BasicFloat4<ImplementationType>& f4) noexcept {
+	return BasicFloat4<ImplementationType>::fromData(ImplementationType::abs(f4.data()));
+}
+
+template <class ImplementationType>
+inline BasicFloat4<ImplementationType> sqrt(const BasicFloat4<ImplementationType>& f4) noexcept {
+	return BasicFloat4<ImplementationType>::fromData(ImplementationType::sqrt(f4.data()));
+}
+
+// Exact 1 / f4.
+template <class ImplementationType>
+inline BasicFloat4<ImplementationType> rcp(const BasicFloat4<ImplementationType>& f4) noexcept {
+	return BasicFloat4<ImplementationType>(1.0f) / f4;
+}
+
+// Approximation of 1 / f4 with a relative error of at most 1.5 * 2^-12, improved by each of the
+// REFINEMENT_STEPS Newton-Raphson iterations (one is enough for all but the last couple of bits).
+template <size_t REFINEMENT_STEPS = 0, class ImplementationType>
+inline BasicFloat4<ImplementationType> rcpFast(const BasicFloat4<ImplementationType>& f4) noexcept {
+	using Float4Type = BasicFloat4<ImplementationType>;
+	auto result = Float4Type::fromData(ImplementationType::reciprocalEstimate(f4.data()));
+	for (auto step = size_t(0); step < REFINEMENT_STEPS; ++step) {
+		result = result * (Float4Type(2.0f) - f4 * result);
+	}
+	return result;
+}
+
+// Exact 1 / sqrt(f4).
+template <class ImplementationType>
+inline BasicFloat4<ImplementationType> rsqrt(const BasicFloat4<ImplementationType>& f4) noexcept {
+	return BasicFloat4<ImplementationType>(1.0f) / sqrt(f4);
+}
+
+// Approximation of 1 / sqrt(f4), see rcpFast.
+template <size_t REFINEMENT_STEPS = 0, class ImplementationType>
+inline BasicFloat4<ImplementationType> rsqrtFast(const BasicFloat4<ImplementationType>& f4) noexcept {
+	using Float4Type = BasicFloat4<ImplementationType>;
+	auto result = Float4Type::fromData(ImplementationType::reciprocalSqrtEstimate(f4.data()));
+	for (auto step = size_t(0); step < REFINEMENT_STEPS; ++step) {
+		result = result * (Float4Type(1.5f) - Float4Type(0.5f) * f4 * result * result);
+	}
+	return result;
+}
+
+// -- comparisons and masks
+
+template <class ImplementationType>
+inline BasicFloat4Mask<ImplementationType> cmpLt(
+	const BasicFloat4<ImplementationType>& lhs,
+	const BasicFloat4<ImplementationType>& rhs
+	) noexcept
+{
+	return BasicFloat4Mask<ImplementationType>::fromData(ImplementationType::lessThan(lhs.data(), rhs.data()));
+}
+
+template <class ImplementationType>
+inline BasicFloat4Mask<ImplementationType> cmpLe(
+	const BasicFloat4<ImplementationType>& lhs,
+	const BasicFloat4<ImplementationType>& rhs
+	) noexcept
+{
+	return BasicFloat4Mask<ImplementationType>::fromData(ImplementationType::lessEqual(lhs.data(), rhs.data()));
+}
+
+template <class ImplementationType>
+inline BasicFloat4Mask<ImplementationType> cmpEq(
+	const BasicFloat4<ImplementationType>& lhs,
+	const BasicFloat4<ImplementationType>& rhs
+	) noexcept
+{
+	return BasicFloat4Mask<ImplementationType>::fromData(ImplementationType::equal(lhs.data(), rhs.data()));
+}
+
+// Returns ifTrue in lanes where mask is set and ifFalse elsewhere, without branching.
+template <class ImplementationType>
+inline BasicFloat4<ImplementationType> select(
+	const BasicFloat4Mask<ImplementationType>& mask,
+	const BasicFloat4<ImplementationType>& ifTrue,
+	const BasicFloat4<ImplementationType>& ifFalse
+	) noexcept
+{
+	const auto data = ImplementationType::select(mask.data(), ifTrue.data(), ifFalse.data());
+	return BasicFloat4<ImplementationType>::fromData(data);
+}
+
+// Returns a bit set with bit i set iff lane i of mask is set.
+template <class ImplementationType>
+inline int movemask(const BasicFloat4Mask<ImplementationType>& mask) noexcept {
+	return ImplementationType::moveMask(mask.data());
+}
+
+template <class ImplementationType>
+inline bool all(const BasicFloat4Mask<ImplementationType>& mask) noexcept {
+	return movemask(mask) == 0xf;
+}
+
+template <class ImplementationType>
+inline bool any(const BasicFloat4Mask<ImplementationType>& mask) noexcept {
+	return movemask(mask) != 0;
+}
+
+// -- horizontal operations, each yielding its result replicated across all lanes
+
+template <class ImplementationType>
+inline BasicFloat4<ImplementationType> horizontalAdd(const BasicFloat4<ImplementationType>& f4) noexcept {
+	const auto pairs = f4 + f4.template shuffle<1, 0, 3, 2>();
+	return pairs + pairs.template shuffle<2, 3, 0, 1>();
+}
+
+template <class ImplementationType>
+inline BasicFloat4<ImplementationType> horizontalMin(const BasicFloat4<ImplementationType>& f4) noexcept {
+	const auto pairs = min(f4, f4.template shuffle<1, 0, 3, 2>());
+	return min(pairs, pairs.template shuffle<2, 3, 0, 1>());
+}
+
+template <class ImplementationType>
+inline BasicFloat4<ImplementationType> horizontalMax(const BasicFloat4<ImplementationType>& f4) noexcept {
+	const auto pairs = max(f4, f4.template shuffle<1, 0, 3, 2>());
+	return max(pairs, pairs.template shuffle<2, 3, 0, 1>());
+}
+
+template <class ImplementationType>
+inline BasicFloat4<ImplementationType> dot(
+	const BasicFloat4<ImplementationType>& lhs,
+	const BasicFloat4<ImplementationType>& rhs
+	) noexcept
+{
+	return horizontalAdd(lhs * rhs);
+}
+
+// Returns { low lane X, low lane Y, high lane Z, high lane W }, the two register form of the shuffle member.
+template <size_t X, size_t Y, size_t Z, size_t W, class ImplementationType>
+inline BasicFloat4<ImplementationType> shuffle(
+	const BasicFloat4<ImplementationType>& low,
+	const BasicFloat4<ImplementationType>& high
+	) noexcept
+{
+	static_assert(X < 4 && Y < 4 && Z < 4 && W < 4, "Invalid lane index");
+	return BasicFloat4<ImplementationType>::fromData(
+		ImplementationType::template shuffle<X, Y, Z, W>(low.data(), high.data()));
+}
+
+// Transposes the 4x4 matrix with columns (or rows) c0 to c3 in place.
+template <class ImplementationType>
+inline void transpose(
+	BasicFloat4<ImplementationType>& c0,
+	BasicFloat4<ImplementationType>& c1,
+	BasicFloat4<ImplementationType>& c2,
+	BasicFloat4<ImplementationType>& c3
+	) noexcept
+{
+	auto data0 = c0.data();
+	auto data1 = c1.data();
+	auto data2 = c2.data();
+	auto data3 = c3.data();
+	ImplementationType::transpose(data0, data1, data2, data3);
+	c0 = BasicFloat4<ImplementationType>::fromData(data0);
+	c1 = BasicFloat4<ImplementationType>::fromData(data1);
+	c2 = BasicFloat4<ImplementationType>::fromData(data2);
+	c3 = BasicFloat4<ImplementationType>::fromData(data3);
+}
+
+// Float4 backed by the best implementation available for the target compiler and architecture.
+// Define CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION to force the portable implementation.
+using Float4 = BasicFloat4<detail::NativeFloat4>;
+
+using Float4Mask = BasicFloat4Mask<detail::NativeFloat4>;
+
+// Float4 backed by the portable implementation, regardless of the target.
+using ReferenceFloat4 = BasicFloat4<detail::ReferenceFloat4>;
+
+using ReferenceFloat4Mask = BasicFloat4Mask<detail::ReferenceFloat4>;
+
 } // namespace caramel_math::simd
 
 #endif /* CARAMELMATH_SIMD_FLOAT4_HPP__ */
@@ -0,0 +1,389 @@
+#ifndef CARAMELMATH_SIMD_FLOAT8_HPP__
+#define CARAMELMATH_SIMD_FLOAT8_HPP__
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "detail/instruction-sets.hpp"
+#include "detail/SplitFloat8.hpp"
+#include "Float4.hpp"
+
+#if !defined(CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION) && defined(CARAMELMATH_SIMD_AVX)
+#	include "detail/AvxFloat8.hpp"
+#endif /* !defined(CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION) && defined(CARAMELMATH_SIMD_AVX) */
+
+namespace caramel_math::simd {
+
+namespace detail {
+
+#if !defined(CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION) && defined(CARAMELMATH_SIMD_AVX)
+using NativeFloat8 = AvxFloat8<NativeFloat4>;
+#else
+using NativeFloat8 = SplitFloat8<NativeFloat4>;
+#endif /* !defined(CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION) && defined(CARAMELMATH_SIMD_AVX) */
+
+} // namespace detail
+
+// Result of a lane-wise comparison of two BasicFloat8s.
+template <class ImplementationType>
+class BasicFloat8Mask {
+public:
+
+	using Implementation = ImplementationType;
+
+	using Data = typename Implementation::Mask;
+
+	BasicFloat8Mask() = default;
+
+	friend BasicFloat8Mask operator&(const BasicFloat8Mask& lhs, const BasicFloat8Mask& rhs) noexcept {
+		return fromData(Implementation::maskAnd(lhs.data_, rhs.data_));
+	}
+
+	BasicFloat8Mask& operator&=(const BasicFloat8Mask& other) noexcept {
+		data_ = (*this & other).data_;
+		return *this;
+	}
+
+	friend BasicFloat8Mask operator|(const BasicFloat8Mask& lhs, const BasicFloat8Mask& rhs) noexcept {
+		return fromData(Implementation::maskOr(lhs.data_, rhs.data_));
+	}
+
+	BasicFloat8Mask& operator|=(const BasicFloat8Mask& other) noexcept {
+		data_ = (*this | other).data_;
+		return *this;
+	}
+
+	static BasicFloat8Mask fromData(Data data) noexcept {
+		auto result = BasicFloat8Mask();
+		result.data_ = std::move(data);
+		return result;
+	}
+
+	const Data& data() const noexcept {
+		return data_;
+	}
+
+private:
+
+	Data data_;
+
+};
+
+// Eight float lanes, with the same operations as BasicFloat4. Lanes 0-3 form the low half and lanes 4-7
+// the high half, each of which is a BasicFloat4. Shuffles and lane broadcasts apply the same pattern to
+// both halves independently, which lets 4-lane kernels process two data sets at once.
+template <class ImplementationType>
+class BasicFloat8 {
+public:
+
+	using Implementation = ImplementationType;
+
+	using Data = typename Implementation::Data;
+
+	using Half = BasicFloat4<typename Implementation::Float4Implementation>;
+
+	// Alignment required by loadAligned, storeAligned and streamStore.
+	static constexpr auto ALIGNMENT = alignof(Data);
+
+	static_assert(ALIGNMENT >= 32, "Float8 data expected to be 32-byte aligned");
+
+	BasicFloat8() = default;
+
+	explicit BasicFloat8(float f) noexcept {
+		data_ = Implementation::replicate(f);
+	}
+
+	explicit BasicFloat8(const std::array<float, 8>& values) noexcept {
+		data_ = Implementation::loadUnaligned(values.data());
+	}
+
+	std::array<float, 8> values() const noexcept {
+		auto data = std::array<float, 8>();
+		Implementation::storeUnaligned(data.data(), data_);
+		return data;
+	}
+
+	static BasicFloat8 loadAligned(const float* values) noexcept {
+		assert(isAligned_(values));
+		return fromData(Implementation::load(values));
+	}
+
+	static BasicFloat8 loadUnaligned(const float* values) noexcept {
+		return fromData(Implementation::loadUnaligned(values));
+	}
+
+	void storeAligned(float* values) const noexcept {
+		assert(isAligned_(values));
+		Implementation::store(values, data_);
+	}
+
+	void storeUnaligned(float* values) const noexcept {
+		Implementation::storeUnaligned(values, data_);
+	}
+
+	// Non-temporal store, see BasicFloat4::streamStore.
+	void streamStore(float* values) const noexcept {
+		assert(isAligned_(values));
+		Implementation::streamStore(values, data_);
+	}
+
+	friend BasicFloat8 operator+(const BasicFloat8& lhs, const BasicFloat8& rhs) noexcept {
+		return fromData(Implementation::add(lhs.data_, rhs.data_));
+	}
+
+	BasicFloat8& operator+=(const BasicFloat8& other) noexcept {
+		data_ = (*this + other).data_;
+		return *this;
+	}
+
+	friend BasicFloat8 operator-(const BasicFloat8& lhs, const BasicFloat8& rhs) noexcept {
+		return fromData(Implementation::subtract(lhs.data_, rhs.data_));
+	}
+
+	BasicFloat8& operator-=(const BasicFloat8& other) noexcept {
+		data_ = (*this - other).data_;
+		return *this;
+	}
+
+	friend BasicFloat8 operator*(const BasicFloat8& lhs, const BasicFloat8& rhs) noexcept {
+		return fromData(Implementation::multiply(lhs.data_, rhs.data_));
+	}
+
+	BasicFloat8& operator*=(const BasicFloat8& other) noexcept {
+		data_ = (*this * other).data_;
+		return *this;
+	}
+
+	friend BasicFloat8 operator/(const BasicFloat8& lhs, const BasicFloat8& rhs) noexcept {
+		return fromData(Implementation::divide(lhs.data_, rhs.data_));
+	}
+
+	BasicFloat8& operator/=(const BasicFloat8& other) noexcept {
+		data_ = (*this / other).data_;
+		return *this;
+	}
+
+	// Returns { lane X, lane Y, lane Z, lane W } of each half, without leaving the register.
+	template <size_t X, size_t Y, size_t Z, size_t W>
+	BasicFloat8 shuffle() const noexcept {
+		static_assert(X < 4 && Y < 4 && Z < 4 && W < 4, "Invalid lane index");
+		return fromData(Implementation::template shuffle<X, Y, Z, W>(data_));
+	}
+
+	// Replicates lane LANE of each half across that half.
+	template <size_t LANE>
+	BasicFloat8 broadcastLane() const noexcept {
+		return shuffle<LANE, LANE, LANE, LANE>();
+	}
+
+	template <size_t LANE>
+	float extractLane() const noexcept {
+		static_assert(LANE < 8, "Invalid lane index");
+		return Implementation::template extractLane<LANE>(data_);
+	}
+
+	Half lowHalf() const noexcept {
+		return Half::fromData(Implementation::lowHalf(data_));
+	}
+
+	Half highHalf() const noexcept {
+		return Half::fromData(Implementation::highHalf(data_));
+	}
+
+	static BasicFloat8 fromHalves(const Half& low, const Half& high) noexcept {
+		return fromData(Implementation::fromHalves(low.data(), high.data()));
+	}
+
+	// Wraps implementation specific data, e.g. an __m256 obtained from intrinsics.
+	static BasicFloat8 fromData(const Data& data) noexcept {
+		auto result = BasicFloat8();
+		result.data_ = data;
+		return result;
+	}
+
+	const Data& data() const noexcept {
+		return data_;
+	}
+
+private:
+
+	Data data_;
+
+	static bool isAligned_(const float* values) noexcept {
+		return reinterpret_cast<std::uintptr_t>(values) % ALIGNMENT == 0;
+	}
+
+};
+
+// -- lane-wise math, see the BasicFloat4 overloads
+
+template <class ImplementationType>
+inline BasicFloat8<ImplementationType> madd(
+	const BasicFloat8<ImplementationType>& lhs,
+	const BasicFloat8<ImplementationType>& rhs,
+	const BasicFloat8<ImplementationType>& addend
+	) noexcept
+{
+	const auto data = ImplementationType::multiplyAdd(lhs.data(), rhs.data(), addend.data());
+	return BasicFloat8<ImplementationType>::fromData(data);
+}
+
+template <class ImplementationType>
+inline BasicFloat8<ImplementationType> min(
+	const BasicFloat8<ImplementationType>& lhs,
+	const BasicFloat8<ImplementationType>& rhs
+	) noexcept
+{
+	return BasicFloat8<ImplementationType>::fromData(ImplementationType::min(lhs.data(), rhs.data()));
+}
+
+template <class ImplementationType>
+inline BasicFloat8<ImplementationType> max(
+	const BasicFloat8<ImplementationType>& lhs,
+	const BasicFloat8<ImplementationType>& rhs
+	) noexcept
+{
+	return BasicFloat8<ImplementationType>::fromData(ImplementationType::max(lhs.data(), rhs.data()));
+}
+
+template <class ImplementationType>
+inline BasicFloat8<ImplementationType> abs(const BasicFloat8<ImplementationType>& f8) noexcept {
+	return BasicFloat8<ImplementationType>::fromData(ImplementationType::abs(f8.data()));
+}
+
+template <class ImplementationType>
+inline BasicFloat8<ImplementationType> sqrt(const BasicFloat8<ImplementationType>& f8) noexcept {
+	return BasicFloat8<ImplementationType>::fromData(ImplementationType::sqrt(f8.data()));
+}
+
+template <class ImplementationType>
+inline BasicFloat8<ImplementationType> rcp(const BasicFloat8<ImplementationType>& f8) noexcept {
+	return BasicFloat8<ImplementationType>(1.0f) / f8;
+}
+
+template <size_t REFINEMENT_STEPS = 0, class ImplementationType>
+inline BasicFloat8<ImplementationType> rcpFast(const BasicFloat8<ImplementationType>& f8) noexcept {
+	using Float8Type = BasicFloat8<ImplementationType>;
+	auto result = Float8Type::fromData(ImplementationType::reciprocalEstimate(f8.data()));
+	for (auto step = size_t(0); step < REFINEMENT_STEPS; ++step) {
+		result = result * (Float8Type(2.0f) - f8 * result);
+	}
+	return result;
+}
+
+template <class ImplementationType>
+inline BasicFloat8<ImplementationType> rsqrt(const BasicFloat8<ImplementationType>& f8) noexcept {
+	return BasicFloat8<ImplementationType>(1.0f) / sqrt(f8);
+}
+
+template <size_t REFINEMENT_STEPS = 0, class ImplementationType>
+inline BasicFloat8<ImplementationType> rsqrtFast(const BasicFloat8<ImplementationType>& f8) noexcept {
+	using Float8Type = BasicFloat8<ImplementationType>;
+	auto result = Float8Type::fromData(ImplementationType::reciprocalSqrtEstimate(f8.data()));
+	for (auto step = size_t(0); step < REFINEMENT_STEPS; ++step) {
+		result = result * (Float8Type(1.5f) - Float8Type(0.5f) * f8 * result * result);
+	}
+	return result;
+}
+
+// -- comparisons and masks
+
+template <class ImplementationType>
+inline BasicFloat8Mask<ImplementationType> cmpLt(
+	const BasicFloat8<ImplementationType>& lhs,
+	const BasicFloat8<ImplementationType>& rhs
+	) noexcept
+{
+	return BasicFloat8Mask<ImplementationType>::fromData(ImplementationType::lessThan(lhs.data(), rhs.data()));
+}
+
+template <class ImplementationType>
+inline BasicFloat8Mask<ImplementationType> cmpLe(
+	const BasicFloat8<ImplementationType>& lhs,
+	const BasicFloat8<ImplementationType>& rhs
+	) noexcept
+{
+	return BasicFloat8Mask<ImplementationType>::fromData(ImplementationType::lessEqual(lhs.data(), rhs.data()));
+}
+
+template <class ImplementationType>
+inline BasicFloat8Mask<ImplementationType> cmpEq(
+	const BasicFloat8<ImplementationType>& lhs,
+	const BasicFloat8<ImplementationType>& rhs
+	) noexcept
+{
+	return BasicFloat8Mask<ImplementationType>::fromData(ImplementationType::equal(lhs.data(), rhs.data()));
+}
+
+template <class ImplementationType>
+inline BasicFloat8<ImplementationType> select(
+	const BasicFloat8Mask<ImplementationType>& mask,
+	const BasicFloat8<ImplementationType>& ifTrue,
+	const BasicFloat8<ImplementationType>& ifFalse
+	) noexcept
+{
+	const auto data = ImplementationType::select(mask.data(), ifTrue.data(), ifFalse.data());
+	return BasicFloat8<ImplementationType>::fromData(data);
+}
+
+template <class ImplementationType>
+inline int movemask(const BasicFloat8Mask<ImplementationType>& mask) noexcept {
+	return ImplementationType::moveMask(mask.data());
+}
+
+template <class ImplementationType>
+inline bool all(const BasicFloat8Mask<ImplementationType>& mask) noexcept {
+	return movemask(mask) == 0xff;
+}
+
+template <class ImplementationType>
+inline bool any(const BasicFloat8Mask<ImplementationType>& mask) noexcept {
+	return movemask(mask) != 0;
+}
+
+// -- horizontal operations over all eight lanes, each yielding its result replicated across all lanes
+
+template <class ImplementationType>
+inline BasicFloat8<ImplementationType> horizontalAdd(const BasicFloat8<ImplementationType>& f8) noexcept {
+	const auto half = horizontalAdd(f8.lowHalf() + f8.highHalf());
+	return BasicFloat8<ImplementationType>::fromHalves(half, half);
+}
+
+template <class ImplementationType>
+inline BasicFloat8<ImplementationType> horizontalMin(const BasicFloat8<ImplementationType>& f8) noexcept {
+	const auto half = horizontalMin(min(f8.lowHalf(), f8.highHalf()));
+	return BasicFloat8<ImplementationType>::fromHalves(half, half);
+}
+
+template <class ImplementationType>
+inline BasicFloat8<ImplementationType> horizontalMax(const BasicFloat8<ImplementationType>& f8) noexcept {
+	const auto half = horizontalMax(max(f8.lowHalf(), f8.highHalf()));
+	return BasicFloat8<ImplementationType>::fromHalves(half, half);
+}
+
+template <class ImplementationType>
+inline BasicFloat8<ImplementationType> dot(
+	const BasicFloat8<ImplementationType>& lhs,
+	const BasicFloat8<ImplementationType>& rhs
+	) noexcept
+{
+	return horizontalAdd(lhs * rhs);
+}
+
+// Float8 backed by AVX where the target supports it, and by a pair of native Float4s otherwise.
+// Define CARAMELMATH_SIMD_REFERENCE_IMPLEMENTATION to force the portable implementation.
+using Float8 = BasicFloat8<detail::NativeFloat8>;
+
+using Float8Mask = BasicFloat8Mask<detail::NativeFloat8>;
+
+// Float8 backed by the portable implementation, regardless of the target.
+using ReferenceFloat8 = BasicFloat8<detail::SplitFloat8<detail::ReferenceFloat4>>;
+
+using ReferenceFloat8Mask = BasicFloat8Mask<detail::SplitFloat8<detail::ReferenceFloat4>>;
+
+} // namespace caramel_math::simd
+
+#endif /* CARAMELMATH_SIMD_FLOAT8_HPP__ */
@@ -0,0 +1,192 @@
+#ifndef CARAMELMATH_SIMD_CPUFEATURES_HPP__
+#define CARAMELMATH_SIMD_CPUFEATURES_HPP__
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+
+#include "detail/instruction-sets.hpp"
+
+#if defined(CARAMELMATH_SIMD_X86)
+#	if defined(_MSC_VER)
+#		include <intrin.h>
+#	else
+#		include <cpuid.h>
+#	endif
+#endif /* defined(CARAMELMATH_SIMD_X86) */
+
+namespace caramel_math::simd {
+
+// Tiers of instruction set extensions that kernels may be specialised for, each implying the previous
+// ones. AVX2 also implies FMA3.
+enum class InstructionSet {
+	REFERENCE,
+	SSE2,
+	SSE4_1,
+	AVX2,
+	AVX512,
+};
+
+[[nodiscard]] inline const char* instructionSetName(InstructionSet instructionSet) noexcept {
+	switch (instructionSet) {
+	case InstructionSet::REFERENCE:
+		return "reference";
+	case InstructionSet::SSE2:
+		return "sse2";
+	case InstructionSet::SSE4_1:
+		return "sse4.1";
+	case InstructionSet::AVX2:
+		return "avx2";
+	case InstructionSet::AVX512:
+		return "avx512";
+	}
+	return "unknown";
+}
+
+// Inverse of instructionSetName, empty if name is not one of its results.
+[[nodiscard]] inline std::optional<InstructionSet> parseInstructionSet(const char* name) noexcept {
+	for (auto instructionSet : {
+		InstructionSet::REFERENCE,
+		InstructionSet::SSE2,
+		InstructionSet::SSE4_1,
+		InstructionSet::AVX2,
+		InstructionSet::AVX512
+		})
+	{
+		if (std::strcmp(name, instructionSetName(instructionSet)) == 0) {
+			return instructionSet;
+		}
+	}
+	return std::nullopt;
+}
+
+namespace detail {
+
+#if defined(CARAMELMATH_SIMD_X86)
+
+struct CpuidRegisters {
+	std::uint32_t eax = 0;
+	std::uint32_t ebx = 0;
+	std::uint32_t ecx = 0;
+	std::uint32_t edx = 0;
+};
+
+inline CpuidRegisters cpuid(std::uint32_t leaf) noexcept {
+	auto registers = CpuidRegisters();
+#if defined(_MSC_VER)
+	int values[4];
+	__cpuidex(values, static_cast<int>(leaf), 0);
+	registers = {
+		static_cast<std::uint32_t>(values[0]),
+		static_cast<std::uint32_t>(values[1]),
+		static_cast<std::uint32_t>(values[2]),
+		static_cast<std::uint32_t>(values[3])
+		};
+#else
+	__cpuid_count(leaf, 0, registers.eax, registers.ebx, registers.ecx, registers.edx);
+#endif /* defined(_MSC_VER) */
+	return registers;
+}
+
+// Register state the operating system saves on context switches (XCR0).
+inline std::uint64_t enabledRegisterState() noexcept {
+#if defined(_MSC_VER)
+	return _xgetbv(0);
+#else
+	auto eax = std::uint32_t();
+	auto edx = std::uint32_t();
+	__asm__ volatile ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	return (static_cast<std::uint64_t>(edx) << 32) | eax;
+#endif /* defined(_MSC_VER) */
+}
+
+inline InstructionSet queryInstructionSet() noexcept {
+	constexpr auto bit = [](std::uint32_t value, int index) { return ((value >> index) & 1u) != 0; };
+
+	const auto maxLeaf = cpuid(0).eax;
+	const auto features = cpuid(1);
+
+	if (!bit(features.edx, 26)) {
+		return InstructionSet::REFERENCE;
+	}
+	if (!bit(features.ecx, 19)) {
+		return InstructionSet::SSE2;
+	}
+
+	// AVX registers are only usable if the operating system saves the xmm and ymm state
+	const auto osSavesAvxState = bit(features.ecx, 27) && (enabledRegisterState() & 0x6) == 0x6;
+	const auto avx = bit(features.ecx, 28) && osSavesAvxState;
+	const auto fma = bit(features.ecx, 12);
+	const auto extendedFeatures = (maxLeaf >= 7) ? cpuid(7) : CpuidRegisters();
+
+	if (!avx || !fma || !bit(extendedFeatures.ebx, 5)) {
+		return InstructionSet::SSE4_1;
+	}
+
+	// AVX-512 additionally requires the opmask and zmm state
+	const auto osSavesAvx512State = (enabledRegisterState() & 0xe6) == 0xe6;
+	if (!bit(extendedFeatures.ebx, 16) || !osSavesAvx512State) {
+		return InstructionSet::AVX2;
+	}
+
+	return InstructionSet::AVX512;
+}
+
+#else
+
+inline InstructionSet queryInstructionSet() noexcept {
+	return InstructionSet::REFERENCE;
+}
+
+#endif /* defined(CARAMELMATH_SIMD_X86) */
+
+// The value of the CARAMELMATH_SIMD_INSTRUCTION_SET environment variable, if set to a valid name.
+inline std::optional<InstructionSet> instructionSetFromEnvironment() noexcept {
+	constexpr auto VARIABLE = "CARAMELMATH_SIMD_INSTRUCTION_SET";
+#if defined(_MSC_VER)
+	auto* value = static_cast<char*>(nullptr);
+	auto size = size_t(0);
+	if (_dupenv_s(&value, &size, VARIABLE) != 0 || value == nullptr) {
+		return std::nullopt;
+	}
+	const auto instructionSet = parseInstructionSet(value);
+	std::free(value);
+	return instructionSet;
+#else
+	const auto* value = std::getenv(VARIABLE);
+	return value ? parseInstructionSet(value) : std::nullopt;
+#endif /* defined(_MSC_VER) */
+}
+
+inline std::atomic<InstructionSet>& instructionSetLimit() noexcept {
+	static auto limit = std::atomic<InstructionSet>(
+		instructionSetFromEnvironment().value_or(InstructionSet::AVX512));
+	return limit;
+}
+
+} // namespace detail
+
+// The best instruction set tier supported by this CPU and operating system. Queried once, on first use.
+[[nodiscard]] inline InstructionSet detectInstructionSet() noexcept {
+	static const auto detected = detail::queryInstructionSet();
+	return detected;
+}
+
+// Caps the tier used by dispatched kernels, e.g. to benchmark a lower tier on a better host. The initial
+// limit is read from the CARAMELMATH_SIMD_INSTRUCTION_SET environment variable ("reference", "sse2",
+// "sse4.1", "avx2" or "avx512"), no limit is applied if it is not set.
+inline void limitInstructionSet(InstructionSet limit) noexcept {
+	detail::instructionSetLimit().store(limit, std::memory_order_relaxed);
+}
+
+// The tier dispatched kernels use: the detected one, capped by limitInstructionSet.
+[[nodiscard]] inline InstructionSet activeInstructionSet() noexcept {
+	return std::min(detectInstructionSet(), detail::instructionSetLimit().load(std::memory_order_relaxed));
+}
+
+} // namespace caramel_math::simd
+
+#endif /* CARAMELMATH_SIMD_CPUFEATURES_HPP__ */
@@ -0,0 +1,168 @@
+#ifndef CARAMELMATH_SIMD_DETAIL_AVXDOUBLE4_HPP__
+#define CARAMELMATH_SIMD_DETAIL_AVXDOUBLE4_HPP__
+
+#include "instruction-sets.hpp"
+
+#if defined(CARAMELMATH_SIMD_AVX)
+
+#include <cstddef>
+
+#include <immintrin.h>
+
+namespace caramel_math::simd::detail {
+
+// Four doubles in a single 256-bit AVX register. Visual C++, GCC and Clang share the AVX intrinsics.
+struct AvxDouble4 {
+
+	using Data = __m256d;
+
+	using Mask = __m256d;
+
+	static Data load(const double* xyzw) noexcept {
+		return _mm256_load_pd(xyzw);
+	}
+
+	static Data loadUnaligned(const double* xyzw) noexcept {
+		return _mm256_loadu_pd(xyzw);
+	}
+
+	static Data replicate(double value) noexcept {
+		return _mm256_set1_pd(value);
+	}
+
+	static void store(double* xyzw, Data data) noexcept {
+		_mm256_store_pd(xyzw, data);
+	}
+
+	static void storeUnaligned(double* xyzw, Data data) noexcept {
+		_mm256_storeu_pd(xyzw, data);
+	}
+
+	static void streamStore(double* xyzw, Data data) noexcept {
+		_mm256_stream_pd(xyzw, data);
+	}
+
+	static void streamFence() noexcept {
+		_mm_sfence();
+	}
+
+	static Data add(Data lhs, Data rhs) noexcept {
+		return _mm256_add_pd(lhs, rhs);
+	}
+
+	static Data subtract(Data lhs, Data rhs) noexcept {
+		return _mm256_sub_pd(lhs, rhs);
+	}
+
+	static Data multiply(Data lhs, Data rhs) noexcept {
+		return _mm256_mul_pd(lhs, rhs);
+	}
+
+	static Data divide(Data lhs, Data rhs) noexcept {
+		return _mm256_div_pd(lhs, rhs);
+	}
+
+	static Data multiplyAdd(Data lhs, Data rhs, Data addend) noexcept {
+#if defined(CARAMELMATH_SIMD_FMA)
+		return _mm256_fmadd_pd(lhs, rhs, addend);
+#else
+		return _mm256_add_pd(_mm256_mul_pd(lhs, rhs), addend);
+#endif /* defined(CARAMELMATH_SIMD_FMA) */
+	}
+
+	static Data min(Data lhs, Data rhs) noexcept {
+		return _mm256_min_pd(lhs, rhs);
+	}
+
+	static Data max(Data lhs, Data rhs) noexcept {
+		return _mm256_max_pd(lhs, rhs);
+	}
+
+	static Data abs(Data data) noexcept {
+		return _mm256_andnot_pd(_mm256_set1_pd(-0.0), data);
+	}
+
+	static Data sqrt(Data data) noexcept {
+		return _mm256_sqrt_pd(data);
+	}
+
+	static Mask lessThan(Data lhs, Data rhs) noexcept {
+		return _mm256_cmp_pd(lhs, rhs, _CMP_LT_OS);
+	}
+
+	static Mask lessEqual(Data lhs, Data rhs) noexcept {
+		return _mm256_cmp_pd(lhs, rhs, _CMP_LE_OS);
+	}
+
+	static Mask equal(Data lhs, Data rhs) noexcept {
+		return _mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ);
+	}
+
+	static Mask maskAnd(Mask lhs, Mask rhs) noexcept {
+		return _mm256_and_pd(lhs, rhs);
+	}
+
+	static Mask maskOr(Mask lhs, Mask rhs) noexcept {
+		return _mm256_or_pd(lhs, rhs);
+	}
+
+	static int moveMask(Mask mask) noexcept {
+		return _mm256_movemask_pd(mask);
+	}
+
+	static Data select(Mask mask, Data ifTrue, Data ifFalse) noexcept {
+		return _mm256_blendv_pd(ifFalse, ifTrue, mask);
+	}
+
+	template <size_t X, size_t Y, size_t Z, size_t W>
+	static Data shuffle(Data data) noexcept {
+#if defined(CARAMELMATH_SIMD_AVX2)
+		return _mm256_permute4x64_pd(data, _MM_SHUFFLE(W, Z, Y, X));
+#else
+		// AVX only permutes within 128-bit halves: bring the halves holding X and Z, then Y and W, into place
+		// and blend the two.
+		const auto xz = _mm256_permute2f128_pd(data, data, (X / 2) | ((Z / 2) << 4));
+		const auto yw = _mm256_permute2f128_pd(data, data, (Y / 2) | ((W / 2) << 4));
+		return _mm256_blend_pd(
+			_mm256_permute_pd(xz, (X % 2) | ((Z % 2) << 2)),
+			_mm256_permute_pd(yw, ((Y % 2) << 1) | ((W % 2) << 3)),
+			0xa
+			);
+#endif /* defined(CARAMELMATH_SIMD_AVX2) */
+	}
+
+	template <size_t LANE>
+	static double extractLane(Data data) noexcept {
+		const auto half = (LANE < 2) ? _mm256_castpd256_pd128(data) : _mm256_extractf128_pd(data, 1);
+		if constexpr (LANE % 2 == 0) {
+			return _mm_cvtsd_f64(half);
+		} else {
+			return _mm_cvtsd_f64(_mm_unpackhi_pd(half, half));
+		}
+	}
+
+	// Returns data with lane LANE replaced by value.
+	template <size_t LANE>
+	static Data insertLane(Data data, double value) noexcept {
+		return _mm256_blend_pd(data, _mm256_set1_pd(value), 1 << LANE);
+	}
+
+	static void transpose(Data& c0, Data& c1, Data& c2, Data& c3) noexcept {
+		const auto c01Low = _mm256_unpacklo_pd(c0, c1);
+		const auto c01High = _mm256_unpackhi_pd(c0, c1);
+		const auto c23Low = _mm256_unpacklo_pd(c2, c3);
+		const auto c23High = _mm256_unpackhi_pd(c2, c3);
+
+		c0 = _mm256_permute2f128_pd(c01Low, c23Low, 0x20);
+		c1 = _mm256_permute2f128_pd(c01High, c23High, 0x20);
+		c2 = _mm256_permute2f128_pd(c01Low, c23Low, 0x31);
+		c3 = _mm256_permute2f128_pd(c01High, c23High, 0x31);
+	}
+
+};
+
+} // namespace caramel_math::simd::detail
+
+#endif /* defined(CARAMELMATH_SIMD_AVX) */
+
+#endif /* CARAMELMATH_SIMD_DETAIL_AVXDOUBLE4_HPP__ */
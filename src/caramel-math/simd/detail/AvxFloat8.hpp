@@ -0,0 +1,164 @@
+#ifndef CARAMELMATH_SIMD_DETAIL_AVXFLOAT8_HPP__
+#define CARAMELMATH_SIMD_DETAIL_AVXFLOAT8_HPP__
+
+#include "instruction-sets.hpp"
+
+#if defined(CARAMELMATH_SIMD_AVX)
+
+#include <cstddef>
+
+#include <immintrin.h>
+
+namespace caramel_math::simd::detail {
+
+// Eight lanes in a single 256-bit AVX register. Float4ImplementationType is the SSE implementation
+// whose Data (an __m128) is used for the two halves. Visual C++, GCC and Clang share the AVX intrinsics.
+template <class Float4ImplementationType>
+struct AvxFloat8 {
+
+	using Float4Implementation = Float4ImplementationType;
+
+	using Half = typename Float4Implementation::Data;
+
+	using Data = __m256;
+
+	using Mask = __m256;
+
+	static Data load(const float* values) noexcept {
+		return _mm256_load_ps(values);
+	}
+
+	static Data loadUnaligned(const float* values) noexcept {
+		return _mm256_loadu_ps(values);
+	}
+
+	static Data replicate(float value) noexcept {
+		return _mm256_set1_ps(value);
+	}
+
+	static void store(float* values, Data data) noexcept {
+		_mm256_store_ps(values, data);
+	}
+
+	static void storeUnaligned(float* values, Data data) noexcept {
+		_mm256_storeu_ps(values, data);
+	}
+
+	static void streamStore(float* values, Data data) noexcept {
+		_mm256_stream_ps(values, data);
+	}
+
+	static void streamFence() noexcept {
+		_mm_sfence();
+	}
+
+	static Data add(Data lhs, Data rhs) noexcept {
+		return _mm256_add_ps(lhs, rhs);
+	}
+
+	static Data subtract(Data lhs, Data rhs) noexcept {
+		return _mm256_sub_ps(lhs, rhs);
+	}
+
+	static Data multiply(Data lhs, Data rhs) noexcept {
+		return _mm256_mul_ps(lhs, rhs);
+	}
+
+	static Data divide(Data lhs, Data rhs) noexcept {
+		return _mm256_div_ps(lhs, rhs);
+	}
+
+	static Data multiplyAdd(Data lhs, Data rhs, Data addend) noexcept {
+#if defined(CARAMELMATH_SIMD_FMA)
+		return _mm256_fmadd_ps(lhs, rhs, addend);
+#else
+		return _mm256_add_ps(_mm256_mul_ps(lhs, rhs), addend);
+#endif /* defined(CARAMELMATH_SIMD_FMA) */
+	}
+
+	static Data min(Data lhs, Data rhs) noexcept {
+		return _mm256_min_ps(lhs, rhs);
+	}
+
+	static Data max(Data lhs, Data rhs) noexcept {
+		return _mm256_max_ps(lhs, rhs);
+	}
+
+	static Data abs(Data data) noexcept {
+		return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), data);
+	}
+
+	static Data sqrt(Data data) noexcept {
+		return _mm256_sqrt_ps(data);
+	}
+
+	static Data reciprocalEstimate(Data data) noexcept {
+		return _mm256_rcp_ps(data);
+	}
+
+	static Data reciprocalSqrtEstimate(Data data) noexcept {
+		return _mm256_rsqrt_ps(data);
+	}
+
+	static Mask lessThan(Data lhs, Data rhs) noexcept {
+		return _mm256_cmp_ps(lhs, rhs, _CMP_LT_OS);
+	}
+
+	static Mask lessEqual(Data lhs, Data rhs) noexcept {
+		return _mm256_cmp_ps(lhs, rhs, _CMP_LE_OS);
+	}
+
+	static Mask equal(Data lhs, Data rhs) noexcept {
+		return _mm256_cmp_ps(lhs, rhs, _CMP_EQ_OQ);
+	}
+
+	static Mask maskAnd(Mask lhs, Mask rhs) noexcept {
+		return _mm256_and_ps(lhs, rhs);
+	}
+
+	static Mask maskOr(Mask lhs, Mask rhs) noexcept {
+		return _mm256_or_ps(lhs, rhs);
+	}
+
+	static int moveMask(Mask mask) noexcept {
+		return _mm256_movemask_ps(mask);
+	}
+
+	static Data select(Mask mask, Data ifTrue, Data ifFalse) noexcept {
+		return _mm256_blendv_ps(ifFalse, ifTrue, mask);
+	}
+
+	// Shuffles within each 128-bit half, as the AVX instruction does.
+	template <size_t X, size_t Y, size_t Z, size_t W>
+	static Data shuffle(Data data) noexcept {
+		return _mm256_shuffle_ps(data, data, _MM_SHUFFLE(W, Z, Y, X));
+	}
+
+	template <size_t LANE>
+	static float extractLane(Data data) noexcept {
+		if constexpr (LANE < 4) {
+			return Float4Implementation::template extractLane<LANE>(lowHalf(data));
+		} else {
+			return Float4Implementation::template extractLane<LANE - 4>(highHalf(data));
+		}
+	}
+
+	static Half lowHalf(Data data) noexcept {
+		return _mm256_castps256_ps128(data);
+	}
+
+	static Half highHalf(Data data) noexcept {
+		return _mm256_extractf128_ps(data, 1);
+	}
+
+	static Data fromHalves(Half low, Half high) noexcept {
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+	}
+
+};
+
+} // namespace caramel_math::simd::detail
+
+#endif /* defined(CARAMELMATH_SIMD_AVX) */
+
+#endif /* CARAMELMATH_SIMD_DETAIL_AVXFLOAT8_HPP__ */
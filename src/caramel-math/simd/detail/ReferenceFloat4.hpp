@@ -0,0 +1,226 @@
+#ifndef CARAMELMATH_SIMD_DETAIL_REFERENCEFLOAT4_HPP__
+#define CARAMELMATH_SIMD_DETAIL_REFERENCEFLOAT4_HPP__
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+
+#include "instruction-sets.hpp"
+
+namespace caramel_math::simd::detail {
+
+// Portable implementation operating on plain floats, one lane at a time. Available on every
+// platform and used as the baseline against which the intrinsic implementations are validated.
+struct ReferenceFloat4 {
+
+	struct Data {
+		alignas(16) float xyzw[4];
+	};
+
+	struct Mask {
+		bool xyzw[4];
+	};
+
+	static Data load(const float* xyzw) noexcept {
+		return { { xyzw[0], xyzw[1], xyzw[2], xyzw[3] } };
+	}
+
+	static Data loadUnaligned(const float* xyzw) noexcept {
+		return load(xyzw);
+	}
+
+	static Data replicate(float value) noexcept {
+		return { { value, value, value, value } };
+	}
+
+	static void store(float* xyzw, Data data) noexcept {
+		for (auto i = 0u; i < 4u; ++i) {
+			xyzw[i] = data.xyzw[i];
+		}
+	}
+
+	static void storeUnaligned(float* xyzw, Data data) noexcept {
+		store(xyzw, data);
+	}
+
+	static void streamStore(float* xyzw, Data data) noexcept {
+		store(xyzw, data);
+	}
+
+	static void streamFence() noexcept {
+		std::atomic_thread_fence(std::memory_order_release);
+	}
+
+	static Data add(Data lhs, Data rhs) noexcept {
+		for (auto i = 0u; i < 4u; ++i) {
+			lhs.xyzw[i] += rhs.xyzw[i];
+		}
+		return lhs;
+	}
+
+	static Data subtract(Data lhs, Data rhs) noexcept {
+		for (auto i = 0u; i < 4u; ++i) {
+			lhs.xyzw[i] -= rhs.xyzw[i];
+		}
+		return lhs;
+	}
+
+	static Data multiply(Data lhs, Data rhs) noexcept {
+		for (auto i = 0u; i < 4u; ++i) {
+			lhs.xyzw[i] *= rhs.xyzw[i];
+		}
+		return lhs;
+	}
+
+	static Data divide(Data lhs, Data rhs) noexcept {
+		for (auto i = 0u; i < 4u; ++i) {
+			lhs.xyzw[i] /= rhs.xyzw[i];
+		}
+		return lhs;
+	}
+
+	// Fused only where the native implementations are, so that their results stay comparable bit for bit.
+	static Data multiplyAdd(Data lhs, Data rhs, Data addend) noexcept {
+		for (auto i = 0u; i < 4u; ++i) {
+#if defined(CARAMELMATH_SIMD_FMA)
+			lhs.xyzw[i] = std::fma(lhs.xyzw[i], rhs.xyzw[i], addend.xyzw[i]);
+#else
+			lhs.xyzw[i] = lhs.xyzw[i] * rhs.xyzw[i] + addend.xyzw[i];
+#endif /* defined(CARAMELMATH_SIMD_FMA) */
+		}
+		return lhs;
+	}
+
+	static Data min(Data lhs, Data rhs) noexcept {
+		for (auto i = 0u; i < 4u; ++i) {
+			lhs.xyzw[i] = (lhs.xyzw[i] < rhs.xyzw[i]) ? lhs.xyzw[i] : rhs.xyzw[i];
+		}
+		return lhs;
+	}
+
+	static Data max(Data lhs, Data rhs) noexcept {
+		for (auto i = 0u; i < 4u; ++i) {
+			lhs.xyzw[i] = (lhs.xyzw[i] > rhs.xyzw[i]) ? lhs.xyzw[i] : rhs.xyzw[i];
+		}
+		return lhs;
+	}
+
+	static Data abs(Data data) noexcept {
+		for (auto i = 0u; i < 4u; ++i) {
+			data.xyzw[i] = std::fabs(data.xyzw[i]);
+		}
+		return data;
+	}
+
+	static Data sqrt(Data data) noexcept {
+		for (auto i = 0u; i < 4u; ++i) {
+			data.xyzw[i] = std::sqrt(data.xyzw[i]);
+		}
+		return data;
+	}
+
+	static Data reciprocalEstimate(Data data) noexcept {
+		for (auto i = 0u; i < 4u; ++i) {
+			data.xyzw[i] = 1.0f / data.xyzw[i];
+		}
+		return data;
+	}
+
+	static Data reciprocalSqrtEstimate(Data data) noexcept {
+		for (auto i = 0u; i < 4u; ++i) {
+			data.xyzw[i] = 1.0f / std::sqrt(data.xyzw[i]);
+		}
+		return data;
+	}
+
+	static Mask lessThan(Data lhs, Data rhs) noexcept {
+		auto mask = Mask();
+		for (auto i = 0u; i < 4u; ++i) {
+			mask.xyzw[i] = lhs.xyzw[i] < rhs.xyzw[i];
+		}
+		return mask;
+	}
+
+	static Mask lessEqual(Data lhs, Data rhs) noexcept {
+		auto mask = Mask();
+		for (auto i = 0u; i < 4u; ++i) {
+			mask.xyzw[i] = lhs.xyzw[i] <= rhs.xyzw[i];
+		}
+		return mask;
+	}
+
+	static Mask equal(Data lhs, Data rhs) noexcept {
+		auto mask = Mask();
+		for (auto i = 0u; i < 4u; ++i) {
+			mask.xyzw[i] = lhs.xyzw[i] == rhs.xyzw[i];
+		}
+		return mask;
+	}
+
+	static Mask maskAnd(Mask lhs, Mask rhs) noexcept {
+		for (auto i = 0u; i < 4u; ++i) {
+			lhs.xyzw[i] = lhs.xyzw[i] && rhs.xyzw[i];
+		}
+		return lhs;
+	}
+
+	static Mask maskOr(Mask lhs, Mask rhs) noexcept {
+		for (auto i = 0u; i < 4u; ++i) {
+			lhs.xyzw[i] = lhs.xyzw[i] || rhs.xyzw[i];
+		}
+		return lhs;
+	}
+
+	static int moveMask(Mask mask) noexcept {
+		auto result = 0;
+		for (auto i = 0u; i < 4u; ++i) {
+			result |= (mask.xyzw[i] ? 1 : 0) << i;
+		}
+		return result;
+	}
+
+	static Data select(Mask mask, Data ifTrue, Data ifFalse) noexcept {
+		for (auto i = 0u; i < 4u; ++i) {
+			ifTrue.xyzw[i] = mask.xyzw[i] ? ifTrue.xyzw[i] : ifFalse.xyzw[i];
+		}
+		return ifTrue;
+	}
+
+	template <size_t X, size_t Y, size_t Z, size_t W>
+	static Data shuffle(Data data) noexcept {
+		return { { data.xyzw[X], data.xyzw[Y], data.xyzw[Z], data.xyzw[W] } };
+	}
+
+	template <size_t X, size_t Y, size_t Z, size_t W>
+	static Data shuffle(Data low, Data high) noexcept {
+		return { { low.xyzw[X], low.xyzw[Y], high.xyzw[Z], high.xyzw[W] } };
+	}
+
+	template <size_t LANE>
+	static float extractLane(Data data) noexcept {
+		return data.xyzw[LANE];
+	}
+
+	template <size_t LANE>
+	static Data insertLane(Data data, float value) noexcept {
+		data.xyzw[LANE] = value;
+		return data;
+	}
+
+	// Transposes the 4x4 matrix with columns (or rows) c0 to c3 in place.
+	static void transpose(Data& c0, Data& c1, Data& c2, Data& c3) noexcept {
+		Data* columns[] = { &c0, &c1, &c2, &c3 };
+		for (auto i = 0u; i < 4u; ++i) {
+			for (auto j = 0u; j < i; ++j) {
+				const auto stored = columns[i]->xyzw[j];
+				columns[i]->xyzw[j] = columns[j]->xyzw[i];
+				columns[j]->xyzw[i] = stored;
+			}
+		}
+	}
+
+};
+
+} // namespace caramel_math::simd::detail
+
+#endif /* CARAMELMATH_SIMD_DETAIL_REFERENCEFLOAT4_HPP__ */
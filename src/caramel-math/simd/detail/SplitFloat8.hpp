@@ -0,0 +1,195 @@
+#ifndef CARAMELMATH_SIMD_DETAIL_SPLITFLOAT8_HPP__
+#define CARAMELMATH_SIMD_DETAIL_SPLITFLOAT8_HPP__
+
+#include <cstddef>
+
+namespace caramel_math::simd::detail {
+
+// Eight lanes held as two halves of a Float4 implementation, each operation applied to both halves.
+// Used where no eight-wide registers are available, and with ReferenceFloat4 as the reference
+// implementation of Float8. Yields the same results as Float4Implementation, lane for lane.
+template <class Float4ImplementationType>
+struct SplitFloat8 {
+
+	using Float4Implementation = Float4ImplementationType;
+
+	using Half = typename Float4Implementation::Data;
+
+	struct alignas(32) Data {
+		Half low;
+		Half high;
+	};
+
+	struct Mask {
+		typename Float4Implementation::Mask low;
+		typename Float4Implementation::Mask high;
+	};
+
+	static Data load(const float* values) noexcept {
+		return { Float4Implementation::load(values), Float4Implementation::load(values + 4) };
+	}
+
+	static Data loadUnaligned(const float* values) noexcept {
+		return { Float4Implementation::loadUnaligned(values), Float4Implementation::loadUnaligned(values + 4) };
+	}
+
+	static Data replicate(float value) noexcept {
+		const auto half = Float4Implementation::replicate(value);
+		return { half, half };
+	}
+
+	static void store(float* values, const Data& data) noexcept {
+		Float4Implementation::store(values, data.low);
+		Float4Implementation::store(values + 4, data.high);
+	}
+
+	static void storeUnaligned(float* values, const Data& data) noexcept {
+		Float4Implementation::storeUnaligned(values, data.low);
+		Float4Implementation::storeUnaligned(values + 4, data.high);
+	}
+
+	static void streamStore(float* values, const Data& data) noexcept {
+		Float4Implementation::streamStore(values, data.low);
+		Float4Implementation::streamStore(values + 4, data.high);
+	}
+
+	static void streamFence() noexcept {
+		Float4Implementation::streamFence();
+	}
+
+	static Data add(const Data& lhs, const Data& rhs) noexcept {
+		return { Float4Implementation::add(lhs.low, rhs.low), Float4Implementation::add(lhs.high, rhs.high) };
+	}
+
+	static Data subtract(const Data& lhs, const Data& rhs) noexcept {
+		return {
+			Float4Implementation::subtract(lhs.low, rhs.low),
+			Float4Implementation::subtract(lhs.high, rhs.high)
+			};
+	}
+
+	static Data multiply(const Data& lhs, const Data& rhs) noexcept {
+		return {
+			Float4Implementation::multiply(lhs.low, rhs.low),
+			Float4Implementation::multiply(lhs.high, rhs.high)
+			};
+	}
+
+	static Data divide(const Data& lhs, const Data& rhs) noexcept {
+		return {
+			Float4Implementation::divide(lhs.low, rhs.low),
+			Float4Implementation::divide(lhs.high, rhs.high)
+			};
+	}
+
+	static Data multiplyAdd(const Data& lhs, const Data& rhs, const Data& addend) noexcept {
+		return {
+			Float4Implementation::multiplyAdd(lhs.low, rhs.low, addend.low),
+			Float4Implementation::multiplyAdd(lhs.high, rhs.high, addend.high)
+			};
+	}
+
+	static Data min(const Data& lhs, const Data& rhs) noexcept {
+		return { Float4Implementation::min(lhs.low, rhs.low), Float4Implementation::min(lhs.high, rhs.high) };
+	}
+
+	static Data max(const Data& lhs, const Data& rhs) noexcept {
+		return { Float4Implementation::max(lhs.low, rhs.low), Float4Implementation::max(lhs.high, rhs.high) };
+	}
+
+	static Data abs(const Data& data) noexcept {
+		return { Float4Implementation::abs(data.low), Float4Implementation::abs(data.high) };
+	}
+
+	static Data sqrt(const Data& data) noexcept {
+		return { Float4Implementation::sqrt(data.low), Float4Implementation::sqrt(data.high) };
+	}
+
+	static Data reciprocalEstimate(const Data& data) noexcept {
+		return {
+			Float4Implementation::reciprocalEstimate(data.low),
+			Float4Implementation::reciprocalEstimate(data.high)
+			};
+	}
+
+	static Data reciprocalSqrtEstimate(const Data& data) noexcept {
+		return {
+			Float4Implementation::reciprocalSqrtEstimate(data.low),
+			Float4Implementation::reciprocalSqrtEstimate(data.high)
+			};
+	}
+
+	static Mask lessThan(const Data& lhs, const Data& rhs) noexcept {
+		return {
+			Float4Implementation::lessThan(lhs.low, rhs.low),
+			Float4Implementation::lessThan(lhs.high, rhs.high)
+			};
+	}
+
+	static Mask lessEqual(const Data& lhs, const Data& rhs) noexcept {
+		return {
+			Float4Implementation::lessEqual(lhs.low, rhs.low),
+			Float4Implementation::lessEqual(lhs.high, rhs.high)
+			};
+	}
+
+	static Mask equal(const Data& lhs, const Data& rhs) noexcept {
+		return { Float4Implementation::equal(lhs.low, rhs.low), Float4Implementation::equal(lhs.high, rhs.high) };
+	}
+
+	static Mask maskAnd(Mask lhs, Mask rhs) noexcept {
+		return {
+			Float4Implementation::maskAnd(lhs.low, rhs.low),
+			Float4Implementation::maskAnd(lhs.high, rhs.high)
+			};
+	}
+
+	static Mask maskOr(Mask lhs, Mask rhs) noexcept {
+		return { Float4Implementation::maskOr(lhs.low, rhs.low), Float4Implementation::maskOr(lhs.high, rhs.high) };
+	}
+
+	static int moveMask(Mask mask) noexcept {
+		return Float4Implementation::moveMask(mask.low) | (Float4Implementation::moveMask(mask.high) << 4);
+	}
+
+	static Data select(Mask mask, const Data& ifTrue, const Data& ifFalse) noexcept {
+		return {
+			Float4Implementation::select(mask.low, ifTrue.low, ifFalse.low),
+			Float4Implementation::select(mask.high, ifTrue.high, ifFalse.high)
+			};
+	}
+
+	template <size_t X, size_t Y, size_t Z, size_t W>
+	static Data shuffle(const Data& data) noexcept {
+		return {
+			Float4Implementation::template shuffle<X, Y, Z, W>(data.low),
+			Float4Implementation::template shuffle<X, Y, Z, W>(data.high)
+			};
+	}
+
+	template <size_t LANE>
+	static float extractLane(const Data& data) noexcept {
+		if constexpr (LANE < 4) {
+			return Float4Implementation::template extractLane<LANE>(data.low);
+		} else {
+			return Float4Implementation::template extractLane<LANE - 4>(data.high);
+		}
+	}
+
+	static Half lowHalf(const Data& data) noexcept {
+		return data.low;
+	}
+
+	static Half highHalf(const Data& data) noexcept {
+		return data.high;
+	}
+
+	static Data fromHalves(Half low, Half high) noexcept {
+		return { low, high };
+	}
+
+};
+
+} // namespace caramel_math::simd::detail
+
+#endif /* CARAMELMATH_SIMD_DETAIL_SPLITFLOAT8_HPP__ */
@@ -0,0 +1,198 @@
+#ifndef CARAMELMATH_SIMD_DETAIL_SSE2DOUBLE4_HPP__
+#define CARAMELMATH_SIMD_DETAIL_SSE2DOUBLE4_HPP__
+
+#include "instruction-sets.hpp"
+
+#if defined(CARAMELMATH_SIMD_SSE2)
+
+#include <cstddef>
+
+#include <immintrin.h>
+
+namespace caramel_math::simd::detail {
+
+// Four doubles in two 128-bit SSE2 registers, for targets without AVX. Visual C++, GCC and Clang share
+// the SSE2 intrinsics.
+struct Sse2Double4 {
+
+	struct Data {
+		__m128d xy;
+		__m128d zw;
+	};
+
+	using Mask = Data;
+
+	static Data load(const double* xyzw) noexcept {
+		return { _mm_load_pd(xyzw), _mm_load_pd(xyzw + 2) };
+	}
+
+	static Data loadUnaligned(const double* xyzw) noexcept {
+		return { _mm_loadu_pd(xyzw), _mm_loadu_pd(xyzw + 2) };
+	}
+
+	static Data replicate(double value) noexcept {
+		const auto half = _mm_set1_pd(value);
+		return { half, half };
+	}
+
+	static void store(double* xyzw, Data data) noexcept {
+		_mm_store_pd(xyzw, data.xy);
+		_mm_store_pd(xyzw + 2, data.zw);
+	}
+
+	static void storeUnaligned(double* xyzw, Data data) noexcept {
+		_mm_storeu_pd(xyzw, data.xy);
+		_mm_storeu_pd(xyzw + 2, data.zw);
+	}
+
+	static void streamStore(double* xyzw, Data data) noexcept {
+		_mm_stream_pd(xyzw, data.xy);
+		_mm_stream_pd(xyzw + 2, data.zw);
+	}
+
+	static void streamFence() noexcept {
+		_mm_sfence();
+	}
+
+	static Data add(Data lhs, Data rhs) noexcept {
+		return { _mm_add_pd(lhs.xy, rhs.xy), _mm_add_pd(lhs.zw, rhs.zw) };
+	}
+
+	static Data subtract(Data lhs, Data rhs) noexcept {
+		return { _mm_sub_pd(lhs.xy, rhs.xy), _mm_sub_pd(lhs.zw, rhs.zw) };
+	}
+
+	static Data multiply(Data lhs, Data rhs) noexcept {
+		return { _mm_mul_pd(lhs.xy, rhs.xy), _mm_mul_pd(lhs.zw, rhs.zw) };
+	}
+
+	static Data divide(Data lhs, Data rhs) noexcept {
+		return { _mm_div_pd(lhs.xy, rhs.xy), _mm_div_pd(lhs.zw, rhs.zw) };
+	}
+
+	static Data multiplyAdd(Data lhs, Data rhs, Data addend) noexcept {
+#if defined(CARAMELMATH_SIMD_FMA)
+		return { _mm_fmadd_pd(lhs.xy, rhs.xy, addend.xy), _mm_fmadd_pd(lhs.zw, rhs.zw, addend.zw) };
+#else
+		return add(multiply(lhs, rhs), addend);
+#endif /* defined(CARAMELMATH_SIMD_FMA) */
+	}
+
+	static Data min(Data lhs, Data rhs) noexcept {
+		return { _mm_min_pd(lhs.xy, rhs.xy), _mm_min_pd(lhs.zw, rhs.zw) };
+	}
+
+	static Data max(Data lhs, Data rhs) noexcept {
+		return { _mm_max_pd(lhs.xy, rhs.xy), _mm_max_pd(lhs.zw, rhs.zw) };
+	}
+
+	static Data abs(Data data) noexcept {
+		const auto signBit = _mm_set1_pd(-0.0);
+		return { _mm_andnot_pd(signBit, data.xy), _mm_andnot_pd(signBit, data.zw) };
+	}
+
+	static Data sqrt(Data data) noexcept {
+		return { _mm_sqrt_pd(data.xy), _mm_sqrt_pd(data.zw) };
+	}
+
+	static Mask lessThan(Data lhs, Data rhs) noexcept {
+		return { _mm_cmplt_pd(lhs.xy, rhs.xy), _mm_cmplt_pd(lhs.zw, rhs.zw) };
+	}
+
+	static Mask lessEqual(Data lhs, Data rhs) noexcept {
+		return { _mm_cmple_pd(lhs.xy, rhs.xy), _mm_cmple_pd(lhs.zw, rhs.zw) };
+	}
+
+	static Mask equal(Data lhs, Data rhs) noexcept {
+		return { _mm_cmpeq_pd(lhs.xy, rhs.xy), _mm_cmpeq_pd(lhs.zw, rhs.zw) };
+	}
+
+	static Mask maskAnd(Mask lhs, Mask rhs) noexcept {
+		return { _mm_and_pd(lhs.xy, rhs.xy), _mm_and_pd(lhs.zw, rhs.zw) };
+	}
+
+	static Mask maskOr(Mask lhs, Mask rhs) noexcept {
+		return { _mm_or_pd(lhs.xy, rhs.xy), _mm_or_pd(lhs.zw, rhs.zw) };
+	}
+
+	static int moveMask(Mask mask) noexcept {
+		return _mm_movemask_pd(mask.xy) | (_mm_movemask_pd(mask.zw) << 2);
+	}
+
+	static Data select(Mask mask, Data ifTrue, Data ifFalse) noexcept {
+#if defined(CARAMELMATH_SIMD_SSE4_1)
+		return { _mm_blendv_pd(ifFalse.xy, ifTrue.xy, mask.xy), _mm_blendv_pd(ifFalse.zw, ifTrue.zw, mask.zw) };
+#else
+		return {
+			_mm_or_pd(_mm_and_pd(mask.xy, ifTrue.xy), _mm_andnot_pd(mask.xy, ifFalse.xy)),
+			_mm_or_pd(_mm_and_pd(mask.zw, ifTrue.zw), _mm_andnot_pd(mask.zw, ifFalse.zw))
+			};
+#endif /* defined(CARAMELMATH_SIMD_SSE4_1) */
+	}
+
+	template <size_t X, size_t Y, size_t Z, size_t W>
+	static Data shuffle(Data data) noexcept {
+		return {
+			_mm_shuffle_pd(half_<X>(data), half_<Y>(data), (X % 2) | ((Y % 2) << 1)),
+			_mm_shuffle_pd(half_<Z>(data), half_<W>(data), (Z % 2) | ((W % 2) << 1))
+			};
+	}
+
+	template <size_t LANE>
+	static double extractLane(Data data) noexcept {
+		const auto half = half_<LANE>(data);
+		if constexpr (LANE % 2 == 0) {
+			return _mm_cvtsd_f64(half);
+		} else {
+			return _mm_cvtsd_f64(_mm_unpackhi_pd(half, half));
+		}
+	}
+
+	// Returns data with lane LANE replaced by value.
+	template <size_t LANE>
+	static Data insertLane(Data data, double value) noexcept {
+		auto half = half_<LANE>(data);
+		if constexpr (LANE % 2 == 0) {
+			half = _mm_move_sd(half, _mm_set_sd(value));
+		} else {
+			half = _mm_unpacklo_pd(half, _mm_set_sd(value));
+		}
+
+		if constexpr (LANE < 2) {
+			data.xy = half;
+		} else {
+			data.zw = half;
+		}
+		return data;
+	}
+
+	static void transpose(Data& c0, Data& c1, Data& c2, Data& c3) noexcept {
+		const auto transposed0 = Data{ _mm_unpacklo_pd(c0.xy, c1.xy), _mm_unpacklo_pd(c2.xy, c3.xy) };
+		const auto transposed1 = Data{ _mm_unpackhi_pd(c0.xy, c1.xy), _mm_unpackhi_pd(c2.xy, c3.xy) };
+		const auto transposed2 = Data{ _mm_unpacklo_pd(c0.zw, c1.zw), _mm_unpacklo_pd(c2.zw, c3.zw) };
+		const auto transposed3 = Data{ _mm_unpackhi_pd(c0.zw, c1.zw), _mm_unpackhi_pd(c2.zw, c3.zw) };
+
+		c0 = transposed0;
+		c1 = transposed1;
+		c2 = transposed2;
+		c3 = transposed3;
+	}
+
+private:
+
+	template <size_t LANE>
+	static __m128d half_(const Data& data) noexcept {
+		if constexpr (LANE < 2) {
+			return data.xy;
+		} else {
+			return data.zw;
+		}
+	}
+
+};
+
+} // namespace caramel_math::simd::detail
+
+#endif /* defined(CARAMELMATH_SIMD_SSE2) */
+
+#endif /* CARAMELMATH_SIMD_DETAIL_SSE2DOUBLE4_HPP__ */
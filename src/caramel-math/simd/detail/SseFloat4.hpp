@@ -0,0 +1,184 @@
+#ifndef CARAMELMATH_SIMD_DETAIL_SSEFLOAT4_HPP__
+#define CARAMELMATH_SIMD_DETAIL_SSEFLOAT4_HPP__
+
+#if defined(_MSC_VER) || defined(__SSE__)
+
+#include <cstddef>
+
+#include <immintrin.h>
+
+#include "instruction-sets.hpp"
+
+namespace caramel_math::simd::detail {
+
+// Four floats in a single 128-bit SSE register. Visual C++, GCC and Clang share the SSE intrinsics.
+struct SseFloat4 {
+
+	using Data = __m128;
+
+	using Mask = __m128;
+
+	static Data load(const float* xyzw) noexcept {
+		return _mm_load_ps(xyzw);
+	}
+
+	static Data loadUnaligned(const float* xyzw) noexcept {
+		return _mm_loadu_ps(xyzw);
+	}
+
+	static Data replicate(float value) noexcept {
+		return _mm_set1_ps(value);
+	}
+
+	static void store(float* xyzw, Data data) noexcept {
+		_mm_store_ps(xyzw, data);
+	}
+
+	static void storeUnaligned(float* xyzw, Data data) noexcept {
+		_mm_storeu_ps(xyzw, data);
+	}
+
+	static void streamStore(float* xyzw, Data data) noexcept {
+		_mm_stream_ps(xyzw, data);
+	}
+
+	static void streamFence() noexcept {
+		_mm_sfence();
+	}
+
+	static Data add(Data lhs, Data rhs) noexcept {
+		return _mm_add_ps(lhs, rhs);
+	}
+
+	static Data subtract(Data lhs, Data rhs) noexcept {
+		return _mm_sub_ps(lhs, rhs);
+	}
+
+	static Data multiply(Data lhs, Data rhs) noexcept {
+		return _mm_mul_ps(lhs, rhs);
+	}
+
+	static Data divide(Data lhs, Data rhs) noexcept {
+		return _mm_div_ps(lhs, rhs);
+	}
+
+	static Data multiplyAdd(Data lhs, Data rhs, Data addend) noexcept {
+#if defined(CARAMELMATH_SIMD_FMA)
+		return _mm_fmadd_ps(lhs, rhs, addend);
+#else
+		return _mm_add_ps(_mm_mul_ps(lhs, rhs), addend);
+#endif /* defined(CARAMELMATH_SIMD_FMA) */
+	}
+
+	static Data min(Data lhs, Data rhs) noexcept {
+		return _mm_min_ps(lhs, rhs);
+	}
+
+	static Data max(Data lhs, Data rhs) noexcept {
+		return _mm_max_ps(lhs, rhs);
+	}
+
+	static Data abs(Data data) noexcept {
+		return _mm_andnot_ps(_mm_set1_ps(-0.0f), data);
+	}
+
+	static Data sqrt(Data data) noexcept {
+		return _mm_sqrt_ps(data);
+	}
+
+	static Data reciprocalEstimate(Data data) noexcept {
+		return _mm_rcp_ps(data);
+	}
+
+	static Data reciprocalSqrtEstimate(Data data) noexcept {
+		return _mm_rsqrt_ps(data);
+	}
+
+	static Mask lessThan(Data lhs, Data rhs) noexcept {
+		return _mm_cmplt_ps(lhs, rhs);
+	}
+
+	static Mask lessEqual(Data lhs, Data rhs) noexcept {
+		return _mm_cmple_ps(lhs, rhs);
+	}
+
+	static Mask equal(Data lhs, Data rhs) noexcept {
+		return _mm_cmpeq_ps(lhs, rhs);
+	}
+
+	static Mask maskAnd(Mask lhs, Mask rhs) noexcept {
+		return _mm_and_ps(lhs, rhs);
+	}
+
+	static Mask maskOr(Mask lhs, Mask rhs) noexcept {
+		return _mm_or_ps(lhs, rhs);
+	}
+
+	static int moveMask(Mask mask) noexcept {
+		return _mm_movemask_ps(mask);
+	}
+
+	static Data select(Mask mask, Data ifTrue, Data ifFalse) noexcept {
+#if defined(CARAMELMATH_SIMD_SSE4_1)
+		return _mm_blendv_ps(ifFalse, ifTrue, mask);
+#else
+		return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+#endif /* defined(CARAMELMATH_SIMD_SSE4_1) */
+	}
+
+	template <size_t X, size_t Y, size_t Z, size_t W>
+	static Data shuffle(Data data) noexcept {
+		return _mm_shuffle_ps(data, data, _MM_SHUFFLE(W, Z, Y, X));
+	}
+
+	// Returns { low[X], low[Y], high[Z], high[W] }.
+	template <size_t X, size_t Y, size_t Z, size_t W>
+	static Data shuffle(Data low, Data high) noexcept {
+		return _mm_shuffle_ps(low, high, _MM_SHUFFLE(W, Z, Y, X));
+	}
+
+	template <size_t LANE>
+	static float extractLane(Data data) noexcept {
+		if constexpr (LANE == 0) {
+			return _mm_cvtss_f32(data);
+		} else {
+			return _mm_cvtss_f32(shuffle<LANE, LANE, LANE, LANE>(data));
+		}
+	}
+
+	// Returns data with lane LANE replaced by value.
+	template <size_t LANE>
+	static Data insertLane(Data data, float value) noexcept {
+#if defined(CARAMELMATH_SIMD_SSE4_1)
+		return _mm_insert_ps(data, _mm_set_ss(value), LANE << 4);
+#else
+		if constexpr (LANE == 0) {
+			return _mm_move_ss(data, _mm_set_ss(value));
+		} else {
+			// Swap lanes 0 and LANE, replace lane 0 and swap back.
+			const auto swapped = shuffle<LANE, (LANE == 1 ? 0 : 1), (LANE == 2 ? 0 : 2), (LANE == 3 ? 0 : 3)>(data);
+			return shuffle<LANE, (LANE == 1 ? 0 : 1), (LANE == 2 ? 0 : 2), (LANE == 3 ? 0 : 3)>(
+				_mm_move_ss(swapped, _mm_set_ss(value)));
+		}
+#endif /* defined(CARAMELMATH_SIMD_SSE4_1) */
+	}
+
+	// Transposes the 4x4 matrix with columns (or rows) c0 to c3 in place, as _MM_TRANSPOSE4_PS does.
+	static void transpose(Data& c0, Data& c1, Data& c2, Data& c3) noexcept {
+		const auto c01Low = _mm_unpacklo_ps(c0, c1);
+		const auto c23Low = _mm_unpacklo_ps(c2, c3);
+		const auto c01High = _mm_unpackhi_ps(c0, c1);
+		const auto c23High = _mm_unpackhi_ps(c2, c3);
+		c0 = _mm_movelh_ps(c01Low, c23Low);
+		c1 = _mm_movehl_ps(c23Low, c01Low);
+		c2 = _mm_movelh_ps(c01High, c23High);
+		c3 = _mm_movehl_ps(c23High, c01High);
+	}
+
+};
+
+} // namespace caramel_math::simd::detail
+
+#endif /* defined(_MSC_VER) || defined(__SSE__) */
+
+#endif /* CARAMELMATH_SIMD_DETAIL_SSEFLOAT4_HPP__ */
@@ -0,0 +1,46 @@
+#ifndef CARAMELMATH_SIMD_DETAIL_INSTRUCTIONSETS_HPP__
+#define CARAMELMATH_SIMD_DETAIL_INSTRUCTIONSETS_HPP__
+
+#include <cmath>
+
+// Instruction set extensions enabled for the target. GCC and Clang announce each extension separately,
+// Visual C++ only defines __AVX__ and __AVX2__ (for /arch:AVX and /arch:AVX2), which imply the rest.
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define CARAMELMATH_SIMD_SSE2
+#endif
+
+#if defined(__SSE4_1__) || (defined(_MSC_VER) && defined(__AVX__))
+#	define CARAMELMATH_SIMD_SSE4_1
+#endif
+
+#if defined(__AVX__)
+#	define CARAMELMATH_SIMD_AVX
+#endif
+
+#if defined(__AVX2__)
+#	define CARAMELMATH_SIMD_AVX2
+#endif
+
+#if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__)) || defined(FP_FAST_FMAF)
+#	define CARAMELMATH_SIMD_FMA
+#endif
+
+// x86 targets, on which instruction set extensions beyond the compile-time baseline may be detected and
+// used at runtime, see cpu-features.hpp.
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#	define CARAMELMATH_SIMD_X86
+#endif
+
+// Compiles a function for the given extensions (e.g. "avx2,fma"), regardless of the target baseline. Such
+// functions may only be called after checking the extensions are supported at runtime. Visual C++ makes all
+// intrinsics available without it.
+
+#if defined(_MSC_VER)
+#	define CARAMELMATH_SIMD_TARGET(extensions)
+#else
+#	define CARAMELMATH_SIMD_TARGET(extensions) __attribute__((target(extensions)))
+#endif
+
+#endif /* CARAMELMATH_SIMD_DETAIL_INSTRUCTIONSETS_HPP__ */
@@ -17,7 +17,7 @@ class AffineTransformStorageTest : public MockErrorHandlerFixtureTest {
 };
 
 TEST_F(AffineTransformStorageTest, IsDefaultConstructible) {
-	auto storage = AffineTransformStorage<BasicScalarTraits<int>, MockErrorHandlerProxy>();
+	[[maybe_unused]] auto storage = AffineTransformStorage<BasicScalarTraits<int>, MockErrorHandlerProxy>();
 }
 
 TEST_F(AffineTransformStorageTest, IsConstructibleWithListOfValues) {
@@ -1,3 +1,5 @@
+#include <array>
+
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
@@ -17,7 +19,7 @@ class ArrayStorageTest : public MockErrorHandlerFixtureTest {
 };
 
 TEST_F(ArrayStorageTest, IsDefaultConstructible) {
-	auto storage = ArrayStorage<BasicScalarTraits<int>, 1, 2, MockErrorHandlerProxy>();
+	[[maybe_unused]] auto storage = ArrayStorage<BasicScalarTraits<int>, 1, 2, MockErrorHandlerProxy>();
 }
 
 TEST_F(ArrayStorageTest, IsConstructibleWithListOfValues) {
@@ -35,6 +37,26 @@ TEST_F(ArrayStorageTest, IsConstructibleWithListOfValues) {
 	EXPECT_EQ(storage.get(1_row, 2_col), 5);
 }
 
+TEST_F(ArrayStorageTest, ColumnMajorStorageIsConstructibleWithRowsOfValues) {
+	using Storage = ArrayStorage<BasicScalarTraits<int>, 2, 3, MockErrorHandlerProxy, MajorOrder::COLUMN>;
+	auto storage = Storage(
+		0, 1, 2,
+		3, 4, 5
+		);
+
+	EXPECT_EQ(storage.get(0_row, 0_col), 0);
+	EXPECT_EQ(storage.get(0_row, 1_col), 1);
+	EXPECT_EQ(storage.get(0_row, 2_col), 2);
+	EXPECT_EQ(storage.get(1_row, 0_col), 3);
+	EXPECT_EQ(storage.get(1_row, 1_col), 4);
+	EXPECT_EQ(storage.get(1_row, 2_col), 5);
+
+	const auto expectedData = std::array<int, 6>{ 0, 3, 1, 4, 2, 5 };
+	for (auto index = 0u; index < 6; ++index) {
+		EXPECT_EQ(storage.data()[index], expectedData[index]);
+	}
+}
+
 TEST_F(ArrayStorageTest, ArrayStorageIsCopyable) {
 	using Storage = ArrayStorage<BasicScalarTraits<int>, 2, 3, MockErrorHandlerProxy>;
 	auto storage = Storage(
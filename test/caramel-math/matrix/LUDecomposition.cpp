@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include "caramel-math/matrix/LUDecomposition.hpp"
+
+#include "caramel-math/matrix/Matrix.hpp"
+#include "caramel-math/matrix/ArrayStorage.hpp"
+#include "caramel-math/matrix/ThrowingErrorHandler.hpp"
+#include "caramel-math/scalar/ScalarTraits.hpp"
+
+using namespace caramel_math;
+using namespace caramel_math::matrix;
+using namespace caramel_math::scalar;
+using namespace caramel_math::matrix::literals;
+
+namespace /* anonymous */ {
+
+using Matrix6 = Matrix<ArrayStorage<BasicScalarTraits<double>, 6, 6, ThrowingErrorHandler>>;
+
+// Has a zero in the top-left corner, so the decomposition must pivot.
+Matrix6 pivotingMatrix() {
+	return Matrix6(
+		0.0, 2.0, 1.0, 0.0, 3.0, 1.0,
+		4.0, 1.0, 0.0, 2.0, 0.0, 1.0,
+		1.0, 0.0, 5.0, 1.0, 2.0, 0.0,
+		2.0, 3.0, 1.0, 6.0, 1.0, 2.0,
+		0.0, 1.0, 2.0, 1.0, 7.0, 3.0,
+		1.0, 1.0, 0.0, 2.0, 1.0, 8.0
+		);
+}
+
+TEST(LUDecompositionTest, DeterminantMatchesCofactorExpansion) {
+	const auto m = pivotingMatrix();
+
+	auto expected = 0.0;
+	for (auto column = 0_col; column.value() < 6; ++column) {
+		expected += m.get(0_row, column) * cofactor(m, 0_row, column);
+	}
+
+	const auto decomposition = LUDecomposition(m);
+
+	EXPECT_FALSE(decomposition.singular());
+	EXPECT_NEAR(decomposition.determinant(), expected, std::abs(expected) * 1e-12);
+	EXPECT_NEAR(determinant(m), expected, std::abs(expected) * 1e-12);
+}
+
+TEST(LUDecompositionTest, InverseMultipliedByMatrixYieldsIdentity) {
+	const auto m = pivotingMatrix();
+
+	const auto i = LUDecomposition(m).inverse();
+
+	ASSERT_TRUE(i);
+
+	const auto product = *i * m;
+
+	for (auto row = 0_row; row.value() < 6; ++row) {
+		for (auto column = 0_col; column.value() < 6; ++column) {
+			EXPECT_NEAR(product.get(row, column), (row.value() == column.value()) ? 1.0 : 0.0, 1e-12);
+		}
+	}
+
+	const auto generic = inverse(m);
+
+	ASSERT_TRUE(generic);
+	EXPECT_EQ(*generic, *i);
+}
+
+TEST(LUDecompositionTest, SolveYieldsSolutionForEveryRightHandSide) {
+	using RHS = Matrix<ArrayStorage<BasicScalarTraits<double>, 6, 2, ThrowingErrorHandler>>;
+	const auto m = pivotingMatrix();
+	const auto x = RHS(
+		1.0, -2.0,
+		2.0, 0.5,
+		-3.0, 1.0,
+		4.0, 0.0,
+		0.5, 3.0,
+		-1.0, -1.0
+		);
+
+	const auto solution = LUDecomposition(m).solve(m * x);
+
+	ASSERT_TRUE(solution);
+
+	for (auto row = 0_row; row.value() < 6; ++row) {
+		for (auto column = 0_col; column.value() < 2; ++column) {
+			EXPECT_NEAR(solution->get(row, column), x.get(row, column), 1e-12);
+		}
+	}
+}
+
+TEST(LUDecompositionTest, SingularMatrixYieldsZeroDeterminantAndNoSolution) {
+	auto m = pivotingMatrix();
+	for (auto column = 0_col; column.value() < 6; ++column) {
+		m.set(5_row, column, m.get(2_row, column));
+	}
+
+	const auto decomposition = LUDecomposition(m);
+
+	EXPECT_TRUE(decomposition.singular());
+	EXPECT_EQ(decomposition.determinant(), 0.0);
+	EXPECT_FALSE(decomposition.inverse());
+	EXPECT_FALSE(decomposition.solve(Matrix6::IDENTITY));
+	EXPECT_FALSE(inverse(m));
+}
+
+} // anonymous namespace
@@ -4,6 +4,7 @@
 #include "caramel-math/matrix/Matrix.hpp"
 #include "caramel-math/matrix/ArrayStorage.hpp"
 #include "caramel-math/matrix/AffineTransformStorage.hpp"
+#include "caramel-math/matrix/SimdAffineTransformStorage.hpp"
 #include "caramel-math/matrix/SimdStorage.hpp"
 #include "caramel-math/matrix/AssertErrorHandler.hpp"
 #include "caramel-math/matrix/ThrowingErrorHandler.hpp"
@@ -74,6 +75,11 @@ struct IsAffineStorage<AffineTransformStorage<ScalarTraits, ErrorHandler>> {
 	enum { VALUE = true };
 };
 
+template <class ScalarTraits, class ErrorHandler>
+struct IsAffineStorage<SimdAffineTransformStorage<ScalarTraits, ErrorHandler>> {
+	enum { VALUE = true };
+};
+
 template <class StorageType>
 constexpr auto IsAffineStorageV = IsAffineStorage<StorageType>::VALUE;
 
@@ -89,8 +95,12 @@ using ConcreteStorageTypes = testing::Types<
 	ArrayStorage<BasicScalarTraits<float>, 2, 3, AssertErrorHandler>,
 	ArrayStorage<BasicScalarTraits<float>, 3, 3, ThrowingErrorHandler>,
 	ArrayStorage<BasicScalarTraits<float>, 3, 3, AssertErrorHandler>,
+	ArrayStorage<BasicScalarTraits<float>, 2, 3, ThrowingErrorHandler, MajorOrder::COLUMN>,
+	ArrayStorage<BasicScalarTraits<float>, 3, 3, AssertErrorHandler, MajorOrder::COLUMN>,
 	AffineTransformStorage<BasicScalarTraits<float>, ThrowingErrorHandler>,
 	AffineTransformStorage<BasicScalarTraits<float>, AssertErrorHandler>,
+	SimdAffineTransformStorage<BasicScalarTraits<float>, ThrowingErrorHandler>,
+	SimdAffineTransformStorage<BasicScalarTraits<float>, AssertErrorHandler>,
 	SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>,
 	SimdStorage<BasicScalarTraits<float>, AssertErrorHandler>
 	>;
@@ -107,6 +117,8 @@ using AnyValueStorageTypes = testing::Types<
 	ArrayStorage<BasicScalarTraits<float>, 2, 3, AssertErrorHandler>,
 	ArrayStorage<BasicScalarTraits<float>, 3, 3, ThrowingErrorHandler>,
 	ArrayStorage<BasicScalarTraits<float>, 3, 3, AssertErrorHandler>,
+	ArrayStorage<BasicScalarTraits<float>, 2, 3, ThrowingErrorHandler, MajorOrder::COLUMN>,
+	ArrayStorage<BasicScalarTraits<float>, 3, 3, AssertErrorHandler, MajorOrder::COLUMN>,
 	SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>,
 	SimdStorage<BasicScalarTraits<float>, AssertErrorHandler>
 	>;
@@ -280,8 +292,8 @@ TYPED_TEST(AnyValueStorageTest, MatricesAreScalarMultiplicative) {
 	auto index = 0;
 	for (auto row = 0_row; row.value() < MatrixType::ROWS; ++row) {
 		for (auto column = 0_col; column.value() < MatrixType::COLUMNS; ++column) {
-			matrix.set(row, column, MatrixType::Scalar(index));
-			twoTimesMatrix.set(row, column, MatrixType::Scalar(index * 2));
+			matrix.set(row, column, typename MatrixType::Scalar(index));
+			twoTimesMatrix.set(row, column, typename MatrixType::Scalar(index * 2));
 			++index;
 		}
 	}
@@ -301,6 +313,158 @@ TYPED_TEST(AnyValueStorageTest, MatricesAreScalarMultiplicative) {
 	EXPECT_EQ(divisionCopy, matrix);
 }
 
+TYPED_TEST(AnyValueStorageTest, MatricesAreAdditive) {
+	using MatrixType = Matrix<TypeParam>;
+	using Scalar = typename MatrixType::Scalar;
+
+	auto lhs = MatrixType();
+	auto rhs = MatrixType();
+	auto sum = MatrixType();
+	auto difference = MatrixType();
+	auto negated = MatrixType();
+
+	auto index = 0;
+	for (auto row = 0_row; row.value() < MatrixType::ROWS; ++row) {
+		for (auto column = 0_col; column.value() < MatrixType::COLUMNS; ++column) {
+			lhs.set(row, column, Scalar(index));
+			rhs.set(row, column, Scalar(index * 3 - 5));
+			sum.set(row, column, Scalar(index * 4 - 5));
+			difference.set(row, column, Scalar(5 - index * 2));
+			negated.set(row, column, Scalar(-index));
+			++index;
+		}
+	}
+
+	EXPECT_EQ(lhs + rhs, sum);
+	EXPECT_EQ(lhs - rhs, difference);
+	EXPECT_EQ(-lhs, negated);
+
+	auto additionCopy = lhs;
+	additionCopy += rhs;
+	EXPECT_EQ(additionCopy, sum);
+
+	auto subtractionCopy = lhs;
+	subtractionCopy -= rhs;
+	EXPECT_EQ(subtractionCopy, difference);
+
+	if constexpr (std::is_same_v<typename TypeParam::ErrorHandler, ThrowingErrorHandler>) {
+		static_assert(!noexcept(std::declval<MatrixType>() + std::declval<MatrixType>()));
+		static_assert(!noexcept(std::declval<MatrixType&>() -= std::declval<MatrixType>()));
+		static_assert(!noexcept(-std::declval<MatrixType>()));
+	} else {
+		static_assert(noexcept(std::declval<MatrixType>() + std::declval<MatrixType>()));
+		static_assert(noexcept(std::declval<MatrixType&>() -= std::declval<MatrixType>()));
+		static_assert(noexcept(-std::declval<MatrixType>()));
+	}
+}
+
+TEST(MatrixTest, AdditionOfViewAndMatrixYieldsElementWiseSum) {
+	using Matrix = Matrix<ArrayStorage<BasicScalarTraits<int>, 2, 2, ThrowingErrorHandler>>;
+	const auto lhs = Matrix(
+		1, 2,
+		3, 4
+		);
+	const auto rhs = Matrix(
+		10, 20,
+		30, 40
+		);
+
+	const auto sum = viewTransposed(lhs) + rhs;
+
+	static_assert(std::is_same_v<std::decay_t<decltype(sum)>, Matrix>);
+	EXPECT_EQ(sum, Matrix(11, 23, 32, 44));
+}
+
+template <class AffineStorageType>
+void expectElementWiseOperationsOfAffineTransformsYieldFullMatrices() {
+	using AffineMatrix = Matrix<AffineStorageType>;
+	using FullMatrix = Matrix<ArrayStorage<BasicScalarTraits<float>, 4, 4, ThrowingErrorHandler>>;
+	const auto a = AffineMatrix(
+		1.0f, 2.0f, 3.0f, 4.0f,
+		5.0f, 6.0f, 7.0f, 8.0f,
+		9.0f, 10.0f, 11.0f, 12.0f
+		);
+	const auto full = FullMatrix(a);
+
+	const auto sum = a + a;
+	const auto difference = a - a;
+	const auto negated = -a;
+
+	static_assert(std::is_same_v<std::decay_t<decltype(sum)>, FullMatrix>);
+	static_assert(std::is_same_v<std::decay_t<decltype(difference)>, FullMatrix>);
+	static_assert(std::is_same_v<std::decay_t<decltype(negated)>, FullMatrix>);
+
+	EXPECT_EQ(sum, full * 2.0f);
+	EXPECT_EQ(difference, full * 0.0f);
+	EXPECT_EQ(negated, full * -1.0f);
+	EXPECT_EQ(a + full, full * 2.0f);
+}
+
+TEST(MatrixTest, ElementWiseOperationsOfAffineTransformsYieldFullMatrices) {
+	expectElementWiseOperationsOfAffineTransformsYieldFullMatrices<
+		AffineTransformStorage<BasicScalarTraits<float>, ThrowingErrorHandler>
+		>();
+}
+
+TEST(MatrixTest, ElementWiseOperationsOfSimdAffineTransformsYieldFullMatrices) {
+	expectElementWiseOperationsOfAffineTransformsYieldFullMatrices<
+		SimdAffineTransformStorage<BasicScalarTraits<float>, ThrowingErrorHandler>
+		>();
+}
+
+TEST(MatrixTest, DivisionOfIntegralMatrixByScalarTruncates) {
+	using Matrix = Matrix<ArrayStorage<BasicScalarTraits<int>, 2, 2, ThrowingErrorHandler>>;
+	auto matrix = Matrix(
+		7, -7,
+		9, 1
+		);
+
+	matrix /= 2;
+
+	EXPECT_EQ(matrix, Matrix(3, -3, 4, 0));
+}
+
+TEST(MatrixTest, ConversionBetweenRowAndColumnMajorStoragesPreservesElements) {
+	using RowMajorMatrix = Matrix<ArrayStorage<BasicScalarTraits<float>, 4, 4, AssertErrorHandler>>;
+	using ColumnMajorMatrix = Matrix<SimdStorage<BasicScalarTraits<float>, AssertErrorHandler>>;
+	using DoubleMatrix = Matrix<ArrayStorage<BasicScalarTraits<double>, 4, 4, AssertErrorHandler>>;
+	const auto rowMajor = RowMajorMatrix(
+		0.0f, 1.0f, 2.0f, 3.0f,
+		4.0f, 5.0f, 6.0f, 7.0f,
+		8.0f, 9.0f, 10.0f, 11.0f,
+		12.0f, 13.0f, 14.0f, 15.0f
+		);
+
+	const auto columnMajor = ColumnMajorMatrix(rowMajor);
+	const auto widened = DoubleMatrix(columnMajor);
+
+	for (auto row = 0_row; row.value() < 4; ++row) {
+		for (auto column = 0_col; column.value() < 4; ++column) {
+			const auto expected = static_cast<float>(row.value() * 4 + column.value());
+			EXPECT_EQ(columnMajor.get(row, column), expected);
+			EXPECT_EQ(widened.get(row, column), expected);
+		}
+	}
+
+	EXPECT_EQ(RowMajorMatrix(columnMajor), rowMajor);
+}
+
+TEST(MatrixTest, AffineTransformsCompareEqualOnStoredElements) {
+	using Matrix = Matrix<AffineTransformStorage<BasicScalarTraits<float>, AssertErrorHandler>>;
+	const auto lhs = Matrix(
+		1.0f, 2.0f, 3.0f, 4.0f,
+		5.0f, 6.0f, 7.0f, 8.0f,
+		9.0f, 10.0f, 11.0f, 12.0f
+		);
+	auto rhs = lhs;
+
+	EXPECT_EQ(lhs, rhs);
+
+	rhs.set(2_row, 3_col, 13.0f);
+
+	EXPECT_NE(lhs, rhs);
+}
+
 TYPED_TEST(AnyValueStorageTest, MatrixMultiplicationByScalarIsNoexceptIfStorageIsNoexcept) {
 	using MatrixType = Matrix<TypeParam>;
 
@@ -335,7 +499,7 @@ TYPED_TEST(ConcreteStorageTest, TransposeTransposesMatrix) {
 	auto index = 0;
 	for (auto row = 0_row; row.value() < TestFixture::MUTABLE_ROWS; ++row) {
 		for (auto column = 0_col; column.value() < MUTABLE_COLUMNS; ++column) {
-			matrix.set(row, column, MatrixType::Scalar(index));
+			matrix.set(row, column, typename MatrixType::Scalar(index));
 			++index;
 		}
 	}
@@ -386,6 +550,119 @@ TEST(MatrixTest, MatrixMultiplicationWorks) {
 	EXPECT_EQ(result.get(1_row, 2_col), 152);
 }
 
+TEST(MatrixTest, UnrolledMatrixMultiplicationMatchesDefinition) {
+	using Matrix3x4 = Matrix<ArrayStorage<BasicScalarTraits<double>, 3, 4, ThrowingErrorHandler>>;
+	using Matrix4x2 = Matrix<ArrayStorage<BasicScalarTraits<double>, 4, 2, ThrowingErrorHandler>>;
+	const auto lhs = Matrix3x4(
+		1.0, -2.0, 3.0, 0.5,
+		4.0, 0.0, -1.0, 2.0,
+		-3.0, 5.0, 2.0, 1.0
+		);
+	const auto rhs = Matrix4x2(
+		2.0, 1.0,
+		-1.0, 3.0,
+		0.5, -2.0,
+		4.0, 0.0
+		);
+
+	const auto product = lhs * rhs;
+	const auto transposedProduct = viewTransposed(rhs) * transposed(lhs);
+
+	for (auto row = 0_row; row.value() < 3; ++row) {
+		for (auto column = 0_col; column.value() < 2; ++column) {
+			auto expected = 0.0;
+			for (auto dotIdx = 0u; dotIdx < 4; ++dotIdx) {
+				expected += lhs.get(row, Column(dotIdx)) * rhs.get(Row(dotIdx), column);
+			}
+			EXPECT_DOUBLE_EQ(product.get(row, column), expected);
+			EXPECT_DOUBLE_EQ(transposedProduct.get(Row(column.value()), Column(row.value())), expected);
+		}
+	}
+}
+
+TEST(MatrixTest, UnrolledMatrixMultiplicationConvertsDotProductsToResultScalar) {
+	using FloatMatrix = Matrix<ArrayStorage<BasicScalarTraits<float>, 2, 2, ThrowingErrorHandler>>;
+	using DoubleMatrix = Matrix<ArrayStorage<BasicScalarTraits<double>, 2, 2, ThrowingErrorHandler>>;
+	using ShortMatrix = Matrix<ArrayStorage<BasicScalarTraits<short>, 2, 2, ThrowingErrorHandler>>;
+
+	const auto shortMatrix = [](short a00, short a01, short a10, short a11) {
+		return ShortMatrix(a00, a01, a10, a11);
+	};
+
+	const auto mixedProduct = FloatMatrix(1.0f, 2.0f, 3.0f, 4.0f) * DoubleMatrix(0.5, 0.0, 0.0, 2.0);
+	const auto shortProduct = shortMatrix(1, 2, 3, 4) * shortMatrix(2, 0, 0, -1);
+
+	static_assert(std::is_same_v<std::decay_t<decltype(mixedProduct)>, FloatMatrix>);
+	static_assert(std::is_same_v<std::decay_t<decltype(shortProduct)>, ShortMatrix>);
+	EXPECT_EQ(mixedProduct, FloatMatrix(0.5f, 4.0f, 1.5f, 8.0f));
+	EXPECT_EQ(shortProduct, shortMatrix(2, -2, 6, -4));
+}
+
+TEST(MatrixTest, LoopedMatrixMultiplicationMatchesDefinitionForEveryLayout) {
+	using Matrix5x6 = Matrix<ArrayStorage<BasicScalarTraits<double>, 5, 6, ThrowingErrorHandler>>;
+	using Matrix5x4 = Matrix<ArrayStorage<BasicScalarTraits<double>, 5, 4, ThrowingErrorHandler>>;
+	auto lhs = Matrix5x6();
+	auto rhs = Matrix5x4();
+	for (auto row = 0_row; row.value() < 5; ++row) {
+		for (auto column = 0_col; column.value() < 6; ++column) {
+			lhs.set(row, column, static_cast<double>(row.value() * 6 + column.value()) - 7.5);
+		}
+		for (auto column = 0_col; column.value() < 4; ++column) {
+			rhs.set(row, column, 0.5 * static_cast<double>(column.value() * 5 + row.value()) - 3.0);
+		}
+	}
+
+	const auto lhsTransposed = Matrix<ArrayStorage<BasicScalarTraits<double>, 6, 5, ThrowingErrorHandler>>(
+		transposed(lhs));
+	const auto rhsTransposed = Matrix<ArrayStorage<BasicScalarTraits<double>, 4, 5, ThrowingErrorHandler>>(
+		transposed(rhs));
+
+	const auto product = transposed(lhs) * rhs;
+	const auto transposedProduct = rhsTransposed * transposed(lhsTransposed);
+
+	static_assert(decltype(product)::Storage::MAJOR_ORDER == MajorOrder::COLUMN);
+	static_assert(decltype(transposedProduct)::Storage::MAJOR_ORDER == MajorOrder::ROW);
+
+	for (auto row = 0_row; row.value() < 6; ++row) {
+		for (auto column = 0_col; column.value() < 4; ++column) {
+			auto expected = 0.0;
+			for (auto dotIdx = 0u; dotIdx < 5; ++dotIdx) {
+				expected += lhs.get(Row(dotIdx), Column(row.value())) * rhs.get(Row(dotIdx), column);
+			}
+			EXPECT_DOUBLE_EQ(product.get(row, column), expected);
+			EXPECT_DOUBLE_EQ(transposedProduct.get(Row(column.value()), Column(row.value())), expected);
+		}
+	}
+}
+
+TEST(MatrixTest, ProductsWithTransposedViewsMatchProductsWithTransposedMatrices) {
+	using Matrix4x4 = Matrix<ArrayStorage<BasicScalarTraits<float>, 4, 4, ThrowingErrorHandler>>;
+	using Matrix6x6 = Matrix<ArrayStorage<BasicScalarTraits<double>, 6, 6, ThrowingErrorHandler>>;
+	auto a = Matrix4x4();
+	auto b = Matrix4x4();
+	auto c = Matrix6x6();
+	auto d = Matrix6x6();
+	for (auto row = 0_row; row.value() < 6; ++row) {
+		for (auto column = 0_col; column.value() < 6; ++column) {
+			const auto value = static_cast<double>(row.value() * 6 + column.value());
+			if (row.value() < 4 && column.value() < 4) {
+				a.set(row, column, static_cast<float>(value) - 5.0f);
+				b.set(row, column, 2.0f - 0.5f * static_cast<float>(value));
+			}
+			c.set(row, column, 0.25 * value - 4.0);
+			d.set(row, column, 7.0 - value);
+		}
+	}
+
+	EXPECT_EQ(viewTransposed(a) * b, Matrix4x4(transposed(a)) * b);
+	EXPECT_EQ(a * viewTransposed(b), a * Matrix4x4(transposed(b)));
+	EXPECT_EQ(viewTransposed(a) * viewTransposed(b), Matrix4x4(transposed(a)) * Matrix4x4(transposed(b)));
+
+	EXPECT_EQ(viewTransposed(c) * d, Matrix6x6(transposed(c)) * d);
+	EXPECT_EQ(c * viewTransposed(d), c * Matrix6x6(transposed(d)));
+	EXPECT_EQ(viewTransposed(c) * viewTransposed(d), Matrix6x6(transposed(c)) * Matrix6x6(transposed(d)));
+}
+
 TEST(MatrixTest, MatrixMultiplicationWithAssignmentWorks) {
 	auto lhsMatrix = Matrix<ArrayStorage<BasicScalarTraits<int>, 2, 2, ThrowingErrorHandler>>();
 	lhsMatrix.set(0_row, 0_col, 0);
@@ -469,7 +746,10 @@ TEST(MatrixTest, AffineTransformMatrixMultiplicationWorks) {
 
 TEST(MatrixTest, TransposedYieldsEffectiveTypeForSquareMatrices) {
 	using ArrayStorageMatrix = Matrix<ArrayStorage<BasicScalarTraits<int>, 4, 4, ThrowingErrorHandler>>;
-	static_assert(std::is_same_v<decltype(transposed(std::declval<ArrayStorageMatrix>())), ArrayStorageMatrix>);
+	using ColumnMajorMatrix =
+		Matrix<ArrayStorage<BasicScalarTraits<int>, 4, 4, ThrowingErrorHandler, MajorOrder::COLUMN>>;
+	static_assert(std::is_same_v<decltype(transposed(std::declval<ArrayStorageMatrix>())), ColumnMajorMatrix>);
+	static_assert(std::is_same_v<decltype(transposed(std::declval<ColumnMajorMatrix>())), ArrayStorageMatrix>);
 
 	using AffineTransformMatrix = Matrix<AffineTransformStorage<BasicScalarTraits<int>, ThrowingErrorHandler>>;
 	static_assert(std::is_same_v<decltype(transposed(std::declval<AffineTransformMatrix>())), ArrayStorageMatrix>);
@@ -478,6 +758,28 @@ TEST(MatrixTest, TransposedYieldsEffectiveTypeForSquareMatrices) {
 	static_assert(std::is_same_v<decltype(transposed(std::declval<SimdMatrix>())), SimdMatrix>);
 }
 
+TEST(MatrixTest, TransposedArrayStorageMatrixKeepsTheElementArray) {
+	using Matrix2x3 = Matrix<ArrayStorage<BasicScalarTraits<int>, 2, 3, ThrowingErrorHandler>>;
+	const auto m = Matrix2x3(
+		1, 2, 3,
+		4, 5, 6
+		);
+
+	const auto t = transposed(m);
+
+	static_assert(decltype(t)::ROWS == 3 && decltype(t)::COLUMNS == 2);
+	for (auto index = 0u; index < 6; ++index) {
+		EXPECT_EQ(t.storage().data()[index], m.storage().data()[index]);
+	}
+	const auto expected = Matrix<ArrayStorage<BasicScalarTraits<int>, 3, 2, ThrowingErrorHandler>>(
+		1, 4,
+		2, 5,
+		3, 6
+		);
+	EXPECT_EQ(t, expected);
+	EXPECT_EQ(transposed(t), m);
+}
+
 TEST(MatrixTest, TransposedYieldsOriginalMatrixForTransposedViewMatrix) {
 	using Matrix = Matrix<ArrayStorage<BasicScalarTraits<int>, 4, 4, ThrowingErrorHandler>>;
 	const auto m = Matrix();
@@ -520,6 +822,169 @@ TEST(MatrixTest, InverseYieldsMatrixInverse) {
 	EXPECT_FLOAT_EQ(i->get(2_row, 2_col), 1.0f / 13.0f);
 }
 
+TEST(MatrixTest, DeterminantOfFourByFourAndLargerMatricesYieldsMatrixDeterminant) {
+	using Matrix4 = Matrix<ArrayStorage<BasicScalarTraits<int>, 4, 4, ThrowingErrorHandler>>;
+	using Matrix5 = Matrix<ArrayStorage<BasicScalarTraits<int>, 5, 5, ThrowingErrorHandler>>;
+	const auto m4 = Matrix4(
+		3, 2, -1, 4,
+		2, 1, 5, 7,
+		0, 5, 2, -6,
+		-1, 2, 1, 0
+		);
+	const auto m5 = Matrix5(
+		2, 0, 0, 0, 0,
+		0, 3, 2, -1, 4,
+		0, 2, 1, 5, 7,
+		0, 0, 5, 2, -6,
+		0, -1, 2, 1, 0
+		);
+
+	EXPECT_EQ(determinant(m4), -418);
+	EXPECT_EQ(determinant(viewSubmatrix(m5, Row(0), Column(0))), -418);
+	EXPECT_EQ(determinant(m5), -836);
+}
+
+TEST(MatrixTest, DeterminantOfLargeIntegralMatrixIsExact) {
+	using Matrix = Matrix<ArrayStorage<BasicScalarTraits<long long>, 12, 12, ThrowingErrorHandler>>;
+	// Built as a row-swapped L * U, with a zero leading element so that elimination has to pivot.
+	auto m = Matrix(
+		0, 0, 1, -5, 3, -4, 5, 0, -2, 0, 0, 6,
+		-1, -2, 0, -3, 0, 3, -1, 0, -1, -4, 4, -1,
+		1, 2, 1, 1, 2, -5, 0, 2, -1, 6, -2, 2,
+		-1, -2, 0, 0, -2, 2, -3, 2, -2, -4, 5, -2,
+		1, 0, -1, 4, -3, -1, -2, 2, -1, 4, -2, -1,
+		1, 0, -1, 1, -2, -2, 2, -2, 0, 2, -2, 2,
+		1, 0, -2, 3, -5, -2, 7, -8, 4, -4, -1, 2,
+		0, 2, 2, -3, 7, -1, 0, 7, 0, 8, -3, 1,
+		0, -2, -1, 1, -4, -1, 1, 1, -3, -3, 2, 3,
+		-1, 0, 1, 2, 1, 4, -10, 7, 0, 2, 5, -5,
+		0, -2, 0, -1, -2, -2, 0, 0, -1, -1, 10, 0,
+		-1, 0, 1, -4, 5, 6, -4, -1, 0, -3, -2, -3
+		);
+
+	EXPECT_EQ(determinant(m), 72);
+
+	for (auto column = 0_col; column.value() < 12; ++column) {
+		m.set(11_row, column, m.get(3_row, column));
+	}
+
+	EXPECT_EQ(determinant(m), 0);
+}
+
+TEST(MatrixTest, DeterminantOfLargeIntegralMatrixIsExactWhenIntermediateProductsOverflowIntmax) {
+	using Matrix = Matrix<ArrayStorage<BasicScalarTraits<long long>, 12, 12, ThrowingErrorHandler>>;
+	// The last elimination steps multiply pairs of 11x11 minors, which does not fit 64 bits.
+	const auto m = Matrix(
+		0, -6, 2, 10, -9, -8, 7, -7, 1, 8, -9, 6,
+		-4, -9, -8, 3, 3, -8, -3, -8, 7, 3, -9, 8,
+		-7, -3, 10, 10, 8, -9, 8, 8, 2, -9, -3, -9,
+		7, -6, -1, 3, -6, 7, -7, 8, -1, 7, -5, -7,
+		8, 8, 10, -4, 1, -7, 7, -8, 8, -9, 9, -4,
+		5, 7, 3, 0, 4, 8, 4, 1, -1, -3, -5, -3,
+		-8, 8, -1, 6, 5, 0, 4, -1, 9, -8, -7, 6,
+		3, -5, 0, -6, 5, 3, -9, -8, 7, 8, 0, 0,
+		1, 9, 5, 8, 4, -8, -8, -2, 5, -8, -9, -1,
+		10, 8, 4, -1, 2, 1, -10, 4, 1, -5, 9, -7,
+		5, -9, -4, -1, -6, -3, 2, 2, 5, -8, -5, 4,
+		2, 7, -2, -6, 3, 7, -2, 3, 1, 2, -3, -6
+		);
+
+	EXPECT_EQ(determinant(m), -12929608498102LL);
+}
+
+TEST(MatrixTest, DeterminantOfIntegralMatrixIsExactWhenIntermediateProductsOverflowScalar) {
+	using Matrix = Matrix<ArrayStorage<BasicScalarTraits<int>, 6, 6, ThrowingErrorHandler>>;
+	// Elimination multiplies minors up to about 10^14 here, while the determinant fits an int.
+	const auto m = Matrix(
+		-10, 30, -21, -5, 11, -27,
+		-26, 22, 4, -24, -7, 7,
+		-27, 28, 2, -17, -28, -25,
+		-3, -4, -26, -15, -25, 5,
+		-3, -27, 22, 6, -23, 30,
+		-16, 10, 10, 7, 30, -27
+		);
+
+	EXPECT_EQ(determinant(m), -446939983);
+}
+
+TEST(MatrixTest, DeterminantOutsideIntmaxIsReportedAsOverflow) {
+	using Matrix = Matrix<ArrayStorage<BasicScalarTraits<long long>, 12, 12, ThrowingErrorHandler>>;
+	// The determinant is 100^12 = 10^24.
+	auto m = Matrix();
+	for (auto index = 0_row; index.value() < Matrix::ROWS; ++index) {
+		m.set(index, Column(index.value()), 100LL);
+	}
+
+	static_assert(!noexcept(determinant(m)));
+	EXPECT_THROW(determinant(m), MatrixArithmeticOverflow);
+}
+
+TEST(MatrixTest, DeterminantOutsideScalarIsReportedAsOverflow) {
+	using Matrix = Matrix<ArrayStorage<BasicScalarTraits<int>, 5, 5, ThrowingErrorHandler>>;
+	// The determinant is 1000^5 = 10^15, which fits std::intmax_t but not int.
+	auto m = Matrix();
+	for (auto index = 0_row; index.value() < Matrix::ROWS; ++index) {
+		m.set(index, Column(index.value()), 1000);
+	}
+
+	EXPECT_THROW(determinant(m), MatrixArithmeticOverflow);
+}
+
+TEST(MatrixTest, InverseOfTwoByTwoMatrixYieldsMatrixInverse) {
+	using Matrix = Matrix<ArrayStorage<BasicScalarTraits<float>, 2, 2, ThrowingErrorHandler>>;
+	const auto m = Matrix(
+		4.0f, 7.0f,
+		2.0f, 6.0f
+		);
+
+	const auto i = inverse(m);
+
+	ASSERT_TRUE(i);
+	EXPECT_FLOAT_EQ(i->get(0_row, 0_col), 0.6f);
+	EXPECT_FLOAT_EQ(i->get(0_row, 1_col), -0.7f);
+	EXPECT_FLOAT_EQ(i->get(1_row, 0_col), -0.2f);
+	EXPECT_FLOAT_EQ(i->get(1_row, 1_col), 0.4f);
+}
+
+TEST(MatrixTest, InverseOfFourByFourMatrixMultipliedByMatrixYieldsIdentity) {
+	using Matrix = Matrix<ArrayStorage<BasicScalarTraits<double>, 4, 4, ThrowingErrorHandler>>;
+	const auto m = Matrix(
+		3.0, 2.0, -1.0, 4.0,
+		2.0, 1.0, 5.0, 7.0,
+		0.0, 5.0, 2.0, -6.0,
+		-1.0, 2.0, 1.0, 0.0
+		);
+
+	const auto i = inverse(m);
+
+	ASSERT_TRUE(i);
+
+	const auto leftProduct = *i * m;
+	const auto rightProduct = m * *i;
+
+	for (auto row = 0_row; row.value() < 4; ++row) {
+		for (auto column = 0_col; column.value() < 4; ++column) {
+			const auto expected = (row.value() == column.value()) ? 1.0 : 0.0;
+			EXPECT_NEAR(leftProduct.get(row, column), expected, 1e-12);
+			EXPECT_NEAR(rightProduct.get(row, column), expected, 1e-12);
+			EXPECT_NEAR(i->get(row, column), cofactor(m, Row(column.value()), Column(row.value())) / -418.0, 1e-12);
+		}
+	}
+}
+
+TEST(MatrixTest, InverseYieldsEmptyOptionalForNonInvertibleFourByFourMatrices) {
+	using Matrix = Matrix<ArrayStorage<BasicScalarTraits<float>, 4, 4, ThrowingErrorHandler>>;
+	const auto m = Matrix(
+		1.0f, 2.0f, 3.0f, 4.0f,
+		5.0f, 6.0f, 7.0f, 8.0f,
+		2.0f, 4.0f, 6.0f, 8.0f,
+		0.0f, 1.0f, 0.0f, 1.0f
+		);
+
+	EXPECT_EQ(determinant(m), 0.0f);
+	EXPECT_FALSE(inverse(m));
+}
+
 TEST(MatrixTest, InverseAffineTransformYieldsMatrixInverse) {
 	using Matrix = Matrix<AffineTransformStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
 	auto m = Matrix::IDENTITY;
@@ -548,6 +1013,61 @@ TEST(MatrixTest, InverseAffineTransformYieldsMatrixInverse) {
 	EXPECT_FLOAT_EQ(i->get(2_row, 3_col), -3.0f);
 }
 
+TEST(MatrixTest, InverseAffineTransformMatchesGenericInverse) {
+	using AffineMatrix = Matrix<AffineTransformStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+	using SimdAffineMatrix = Matrix<SimdAffineTransformStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+	using FullMatrix = Matrix<ArrayStorage<BasicScalarTraits<float>, 4, 4, ThrowingErrorHandler>>;
+	const auto m = AffineMatrix(
+		2.0f, 1.0f, 0.0f, 3.0f,
+		-1.0f, 4.0f, 2.0f, -5.0f,
+		0.5f, 0.0f, 3.0f, 7.0f
+		);
+
+	const auto i = inverse(m);
+	const auto simdI = inverse(SimdAffineMatrix(m));
+	const auto expected = inverse(FullMatrix(m));
+
+	ASSERT_TRUE(i);
+	ASSERT_TRUE(simdI);
+	ASSERT_TRUE(expected);
+	static_assert(std::is_same_v<std::decay_t<decltype(*i)>, AffineMatrix>);
+
+	for (auto row = 0_row; row.value() < 4; ++row) {
+		for (auto column = 0_col; column.value() < 4; ++column) {
+			EXPECT_NEAR(i->get(row, column), expected->get(row, column), 1e-5f);
+			EXPECT_NEAR(simdI->get(row, column), expected->get(row, column), 1e-5f);
+		}
+	}
+}
+
+TEST(MatrixTest, InverseAffineTransformYieldsEmptyOptionalForSingularLinearPart) {
+	using Matrix = Matrix<AffineTransformStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+	const auto m = Matrix(
+		1.0f, 2.0f, 3.0f, 1.0f,
+		2.0f, 4.0f, 6.0f, 2.0f,
+		0.0f, 1.0f, 0.0f, 3.0f
+		);
+
+	EXPECT_FALSE(inverse(m));
+}
+
+TEST(MatrixTest, InverseRigidMatchesInverseForRotationAndTranslation) {
+	using Matrix = Matrix<AffineTransformStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+	// Rotation by 90 degrees around z, then by 90 degrees around x, followed by a translation.
+	const auto m = Matrix(
+		0.0f, -1.0f, 0.0f, 1.0f,
+		0.0f, 0.0f, -1.0f, 2.0f,
+		1.0f, 0.0f, 0.0f, 3.0f
+		);
+
+	const auto rigidInverse = inverseRigid(m);
+	const auto expected = inverse(m);
+
+	ASSERT_TRUE(expected);
+	EXPECT_EQ(rigidInverse, *expected);
+	EXPECT_EQ(rigidInverse * m, Matrix::IDENTITY);
+}
+
 TEST(MatrixTest, InverseYieldsEmptyOptionalForNonInvertibleMatrices) {
 	using Matrix = Matrix<ArrayStorage<BasicScalarTraits<float>, 2, 2, ThrowingErrorHandler>>;
 	const auto m = Matrix(
@@ -0,0 +1,145 @@
+#include <type_traits>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "caramel-math/matrix/MatrixExpression.hpp"
+
+#include "caramel-math/matrix/Matrix.hpp"
+#include "caramel-math/matrix/ArrayStorage.hpp"
+#include "caramel-math/matrix/SimdStorage.hpp"
+#include "caramel-math/matrix/AssertErrorHandler.hpp"
+#include "caramel-math/scalar/ScalarTraits.hpp"
+#include "sequence-matrix.hpp"
+
+using namespace caramel_math;
+using namespace caramel_math::matrix;
+using namespace caramel_math::scalar;
+using namespace caramel_math::matrix::literals;
+using namespace caramel_math::matrix::test;
+
+namespace /* anonymous */ {
+
+// Counts the elements written, to check the number of passes over the destination.
+class CountingStorage : public ArrayStorage<BasicScalarTraits<float>, 4, 4, AssertErrorHandler> {
+public:
+
+	static int setCount;
+
+	using ArrayStorage::ArrayStorage;
+
+	void set(Row row, Column column, float value) noexcept {
+		++setCount;
+		ArrayStorage::set(row, column, value);
+	}
+
+};
+
+int CountingStorage::setCount = 0;
+
+template <class LHSType, class RHSType, class = void>
+struct IsMultipliable : std::false_type {
+};
+
+template <class LHSType, class RHSType>
+struct IsMultipliable<LHSType, RHSType, std::void_t<decltype(std::declval<LHSType>() * std::declval<RHSType>())>> :
+	std::true_type
+{
+};
+
+TEST(MatrixExpressionTest, ProductChainMatchesEagerEvaluation) {
+	using Matrix2x3 = Matrix<ArrayStorage<BasicScalarTraits<float>, 2, 3, AssertErrorHandler>>;
+	using Matrix3x3 = Matrix<ArrayStorage<BasicScalarTraits<float>, 3, 3, AssertErrorHandler>>;
+	using Matrix3x1 = Matrix<ArrayStorage<BasicScalarTraits<float>, 3, 1, AssertErrorHandler>>;
+	const auto a = sequenceMatrix<Matrix2x3>(1.0f);
+	const auto b = sequenceMatrix<Matrix3x3>(-4.0f);
+	const auto c = sequenceMatrix<Matrix3x1>(2.0f);
+
+	const auto expected = a * b * c * 0.5f;
+	const auto lazyResult = decltype(expected)(lazy(a) * b * c * 0.5f);
+	const auto rightAssociated = decltype(expected)(0.5f * (a * (lazy(b) * c)));
+
+	EXPECT_EQ(lazyResult, expected);
+	EXPECT_EQ(rightAssociated, expected);
+}
+
+TEST(MatrixExpressionTest, ScalesOfOperandsApplyToTheProduct) {
+	using MatrixType = Matrix<ArrayStorage<BasicScalarTraits<float>, 3, 3, AssertErrorHandler>>;
+	const auto a = sequenceMatrix<MatrixType>(1.0f);
+	const auto b = sequenceMatrix<MatrixType>(-3.0f);
+
+	const auto expected = a * b * 6.0f;
+	const auto result = MatrixType((lazy(a) * 2.0f) * (3.0f * lazy(b)));
+
+	EXPECT_EQ(result, expected);
+}
+
+TEST(MatrixExpressionTest, TransposedExpressionsMatchEagerEvaluation) {
+	using Matrix2x3 = Matrix<ArrayStorage<BasicScalarTraits<float>, 2, 3, AssertErrorHandler>>;
+	using Matrix3x2 = Matrix<ArrayStorage<BasicScalarTraits<float>, 3, 2, AssertErrorHandler>>;
+	using Matrix2x2 = Matrix<ArrayStorage<BasicScalarTraits<float>, 2, 2, AssertErrorHandler>>;
+	const auto a = sequenceMatrix<Matrix2x3>(1.0f);
+	const auto b = sequenceMatrix<Matrix2x3>(-2.0f);
+
+	EXPECT_EQ(Matrix3x2(transposed(lazy(a))), transposed(a));
+	EXPECT_EQ(Matrix2x2(lazy(a) * transposed(lazy(b))), a * transposed(b));
+	EXPECT_EQ(Matrix2x2(transposed(lazy(a) * transposed(lazy(b)))), transposed(a * transposed(b)));
+}
+
+TEST(MatrixExpressionTest, SimdStorageExpressionsMatchEagerEvaluation) {
+	using MatrixType = Matrix<SimdStorage<BasicScalarTraits<float>, AssertErrorHandler>>;
+	const auto a = sequenceMatrix<MatrixType>(1.0f);
+	const auto b = sequenceMatrix<MatrixType>(-7.0f);
+	const auto c = sequenceMatrix<MatrixType>(0.5f);
+
+	EXPECT_EQ(MatrixType(lazy(a) * b * c * 0.25f), a * b * c * 0.25f);
+	EXPECT_EQ(MatrixType(transposed(lazy(a)) * (lazy(b) * transposed(lazy(c)))), transposed(a) * (b * transposed(c)));
+}
+
+TEST(MatrixExpressionTest, EvaluationWritesEveryElementOnce) {
+	using MatrixType = Matrix<CountingStorage>;
+	const auto a = sequenceMatrix<MatrixType>(1.0f);
+	const auto b = sequenceMatrix<MatrixType>(-2.0f);
+
+	CountingStorage::setCount = 0;
+	const auto eager = a * b * 0.5f;
+	EXPECT_EQ(CountingStorage::setCount, 32);
+
+	CountingStorage::setCount = 0;
+	const auto fused = MatrixType(lazy(a) * 2.0f * b * 0.25f);
+	EXPECT_EQ(CountingStorage::setCount, 16);
+
+	CountingStorage::setCount = 0;
+	const auto unscaled = MatrixType(lazy(a) * b);
+	EXPECT_EQ(CountingStorage::setCount, 16);
+
+	EXPECT_EQ(fused, eager);
+	EXPECT_EQ(unscaled, a * b);
+}
+
+TEST(MatrixExpressionTest, AssignmentToAnOperandYieldsTheExpressionValue) {
+	using MatrixType = Matrix<ArrayStorage<BasicScalarTraits<float>, 3, 3, AssertErrorHandler>>;
+	auto a = sequenceMatrix<MatrixType>(1.0f);
+	const auto b = sequenceMatrix<MatrixType>(-3.0f);
+
+	const auto expectedProduct = a * b;
+	a = lazy(a) * b;
+	EXPECT_EQ(a, expectedProduct);
+
+	const auto expectedTransposed = transposed(a);
+	a = transposed(lazy(a));
+	EXPECT_EQ(a, expectedTransposed);
+}
+
+TEST(MatrixExpressionTest, TemporaryMatricesAreRefusedAsOperands) {
+	using MatrixType = Matrix<ArrayStorage<BasicScalarTraits<float>, 3, 3, AssertErrorHandler>>;
+	using ExpressionType = decltype(lazy(std::declval<const MatrixType&>()));
+
+	static_assert(IsMultipliable<const ExpressionType&, const MatrixType&>::value);
+	static_assert(IsMultipliable<const MatrixType&, const ExpressionType&>::value);
+	static_assert(!IsMultipliable<const ExpressionType&, MatrixType>::value);
+	static_assert(!IsMultipliable<MatrixType, const ExpressionType&>::value);
+	static_assert(!IsMultipliable<const ExpressionType&, const MatrixType&&>::value);
+}
+
+} // anonymous namespace
@@ -16,6 +16,9 @@ struct NoexceptErrorHandler {
 	template <class ScalarType>
 	static void invalidValue(Row row, Column column, ScalarType got, ScalarType expected) noexcept;
 
+	template <class ReturnType>
+	static ReturnType overflow() noexcept;
+
 };
 
 struct PotentiallyThrowingErrorHandler {
@@ -26,6 +29,9 @@ struct PotentiallyThrowingErrorHandler {
 	template <class ScalarType>
 	static void invalidValue(Row row, Column column, ScalarType got, ScalarType expected);
 
+	template <class ReturnType>
+	static ReturnType overflow();
+
 };
 
 struct MockErrorHandler {
@@ -36,6 +42,8 @@ struct MockErrorHandler {
 
 	MOCK_METHOD4(invalidValue, void (Row, Column, int, int));
 
+	MOCK_METHOD0(overflow, int ());
+
 };
 
 struct MockErrorHandlerProxy {
@@ -50,6 +58,11 @@ struct MockErrorHandlerProxy {
 		MockErrorHandler::instance->invalidValue(row, column, static_cast<int>(got), static_cast<int>(expected));
 	}
 
+	template <class ReturnType>
+	static ReturnType overflow() noexcept {
+		return static_cast<ReturnType>(MockErrorHandler::instance->overflow());
+	}
+
 };
 
 class MockErrorHandlerFixtureTest : public testing::Test {
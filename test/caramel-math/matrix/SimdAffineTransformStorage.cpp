@@ -0,0 +1,201 @@
+#include <random>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "caramel-math/matrix/AffineTransformStorage.hpp"
+#include "caramel-math/matrix/SimdAffineTransformStorage.hpp"
+#include "caramel-math/matrix/SimdStorage.hpp"
+#include "caramel-math/matrix/ThrowingErrorHandler.hpp"
+#include "caramel-math/matrix/Matrix.hpp"
+#include "caramel-math/scalar/ScalarTraits.hpp"
+#include "MockErrorHandler.hpp"
+#include "random-matrix.hpp"
+
+using namespace caramel_math;
+using namespace caramel_math::matrix;
+using namespace caramel_math::scalar;
+using namespace caramel_math::matrix::literals;
+using namespace caramel_math::matrix::test;
+
+namespace /* anonymous */ {
+
+class SimdAffineTransformStorageTest : public MockErrorHandlerFixtureTest {
+};
+
+TEST_F(SimdAffineTransformStorageTest, IsDefaultConstructible) {
+	[[maybe_unused]] auto storage = SimdAffineTransformStorage<BasicScalarTraits<float>, MockErrorHandlerProxy>();
+}
+
+TEST_F(SimdAffineTransformStorageTest, IsConstructibleWithListOfValues) {
+	using Storage = SimdAffineTransformStorage<BasicScalarTraits<float>, MockErrorHandlerProxy>;
+	auto storage = Storage(
+		0.0f, 1.0f, 2.0f, 3.0f,
+		4.0f, 5.0f, 6.0f, 7.0f,
+		8.0f, 9.0f, 10.0f, 11.0f
+		);
+
+	for (auto row = 0_row; row.value() < 3; ++row) {
+		for (auto column = 0_col; column.value() < 4; ++column) {
+			EXPECT_FLOAT_EQ(storage.get(row, column), static_cast<float>(row.value() * 4 + column.value()));
+		}
+	}
+
+	EXPECT_FLOAT_EQ(storage.get(3_row, 0_col), 0.0f);
+	EXPECT_FLOAT_EQ(storage.get(3_row, 1_col), 0.0f);
+	EXPECT_FLOAT_EQ(storage.get(3_row, 2_col), 0.0f);
+	EXPECT_FLOAT_EQ(storage.get(3_row, 3_col), 1.0f);
+}
+
+TEST_F(SimdAffineTransformStorageTest, GetAndSetReturnAndUpdateStoredValueAndRow) {
+	auto storage = SimdAffineTransformStorage<BasicScalarTraits<float>, MockErrorHandlerProxy>();
+
+	storage.set(0_row, simd::Float4({ 0.0f, 1.0f, 2.0f, 3.0f }));
+	storage.set(1_row, simd::Float4({ 4.0f, 5.0f, 6.0f, 7.0f }));
+	storage.set(2_row, simd::Float4({ 8.0f, 9.0f, 10.0f, 11.0f }));
+	storage.set(1_row, 2_col, 42.0f);
+
+	EXPECT_FLOAT_EQ(storage.get(0_row, 3_col), 3.0f);
+	EXPECT_FLOAT_EQ(storage.get(1_row, 1_col), 5.0f);
+	EXPECT_FLOAT_EQ(storage.get(1_row, 2_col), 42.0f);
+	EXPECT_FLOAT_EQ(storage.get(2_row, 0_col), 8.0f);
+
+	const auto lastRow = storage.get(3_row).xyzw();
+	EXPECT_FLOAT_EQ(lastRow[0], 0.0f);
+	EXPECT_FLOAT_EQ(lastRow[1], 0.0f);
+	EXPECT_FLOAT_EQ(lastRow[2], 0.0f);
+	EXPECT_FLOAT_EQ(lastRow[3], 1.0f);
+}
+
+TEST_F(SimdAffineTransformStorageTest, SetOfLastRowLeavesStoredRowsUntouched) {
+	auto storage = SimdAffineTransformStorage<BasicScalarTraits<float>, MockErrorHandlerProxy>();
+
+	storage.set(0_row, simd::Float4({ 0.0f, 1.0f, 2.0f, 3.0f }));
+	storage.set(1_row, simd::Float4({ 4.0f, 5.0f, 6.0f, 7.0f }));
+	storage.set(2_row, simd::Float4({ 8.0f, 9.0f, 10.0f, 11.0f }));
+
+	if constexpr (RUNTIME_CHECKS) {
+		EXPECT_CALL(*MockErrorHandler::instance, invalidValue(3_row, 0_col, 42, 0));
+		EXPECT_CALL(*MockErrorHandler::instance, invalidValue(3_row, 1_col, 42, 0));
+		EXPECT_CALL(*MockErrorHandler::instance, invalidValue(3_row, 2_col, 42, 0));
+		EXPECT_CALL(*MockErrorHandler::instance, invalidValue(3_row, 3_col, 42, 1));
+	}
+
+	storage.set(3_row, simd::Float4({ 0.0f, 0.0f, 0.0f, 1.0f }));
+	storage.set(3_row, simd::Float4(42.0f));
+
+	for (auto row = 0_row; row.value() < 3; ++row) {
+		for (auto column = 0_col; column.value() < 4; ++column) {
+			EXPECT_FLOAT_EQ(storage.get(row, column), static_cast<float>(row.value() * 4 + column.value()));
+		}
+	}
+
+	const auto lastRow = storage.get(3_row).xyzw();
+	EXPECT_FLOAT_EQ(lastRow[0], 0.0f);
+	EXPECT_FLOAT_EQ(lastRow[1], 0.0f);
+	EXPECT_FLOAT_EQ(lastRow[2], 0.0f);
+	EXPECT_FLOAT_EQ(lastRow[3], 1.0f);
+}
+
+TEST_F(SimdAffineTransformStorageTest, SetCallsInvalidValueForValuesNotMatchingAnAffineTransformMatrix) {
+	auto storage = SimdAffineTransformStorage<BasicScalarTraits<float>, MockErrorHandlerProxy>();
+
+	{
+		testing::InSequence();
+		EXPECT_CALL(*MockErrorHandler::instance, invalidValue(3_row, 0_col, 1, 0));
+		EXPECT_CALL(*MockErrorHandler::instance, invalidValue(3_row, 3_col, 0, 1));
+	}
+
+	storage.set(3_row, 0_col, 1.0f);
+	storage.set(3_row, 3_col, 0.0f);
+}
+
+TEST_F(SimdAffineTransformStorageTest, GetAndSetWithOutOfBoundsIndexCallErrorHandler) {
+	static_assert(RUNTIME_CHECKS);
+
+	auto storage = SimdAffineTransformStorage<BasicScalarTraits<float>, MockErrorHandlerProxy>();
+
+	EXPECT_CALL(*MockErrorHandler::instance, invalidAccess(4_row, 0_col)).WillRepeatedly(testing::Return(0));
+	EXPECT_CALL(*MockErrorHandler::instance, invalidAccess(0_row, 4_col)).WillRepeatedly(testing::Return(0));
+	EXPECT_CALL(*MockErrorHandler::instance, invalidValue(3_row, 3_col, 0, 1));
+
+	storage.get(4_row, 0_col);
+	storage.get(0_row, 4_col);
+	storage.set(4_row, 0_col, 0.0f);
+	storage.set(0_row, 4_col, 0.0f);
+	storage.set(4_row, simd::Float4(0.0f));
+	storage.set(3_row, simd::Float4({ 0.0f, 0.0f, 0.0f, 1.0f }));
+	storage.set(3_row, simd::Float4(0.0f));
+}
+
+TEST_F(SimdAffineTransformStorageTest, GetAndSetAreNoexceptIfErrorHandlerInvalidAccessIsNoexcept) {
+	auto storage = SimdAffineTransformStorage<BasicScalarTraits<float>, NoexceptErrorHandler>();
+	static_assert(noexcept(storage.get(0_row, 0_col)));
+	static_assert(noexcept(storage.set(0_row, 0_col, 0.0f)));
+}
+
+TEST_F(SimdAffineTransformStorageTest, GetAndSetArePotentiallyThrowingIfErrorHandlerInvalidAccessIsPotentiallyThrowing) {
+	auto storage = SimdAffineTransformStorage<BasicScalarTraits<float>, PotentiallyThrowingErrorHandler>();
+	static_assert(!noexcept(storage.get(0_row, 0_col)));
+	static_assert(!noexcept(storage.set(0_row, 0_col, 0.0f)));
+}
+
+// --- products
+
+class SimdAffineTransformProductTest : public testing::Test {
+protected:
+
+	using SimdAffineMatrix = Matrix<SimdAffineTransformStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+
+	using AffineMatrix = Matrix<AffineTransformStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+
+	using SimdMatrix = Matrix<SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+
+	template <class MatrixType>
+	MatrixType random() {
+		return randomMatrix<MatrixType>(generator_, -10.0f, 10.0f);
+	}
+
+private:
+
+	std::mt19937 generator_ = std::mt19937(42);
+
+};
+
+TEST_F(SimdAffineTransformProductTest, AffineProductMatchesAffineTransformStorage) {
+	for (auto iteration = 0; iteration < 16; ++iteration) {
+		const auto lhs = random<SimdAffineMatrix>();
+		const auto rhs = random<SimdAffineMatrix>();
+
+		const auto product = lhs * rhs;
+		static_assert(std::is_same_v<decltype(product), const SimdAffineMatrix>);
+
+		const auto expected = AffineMatrix(lhs) * AffineMatrix(rhs);
+
+		for (auto row = 0_row; row.value() < 4; ++row) {
+			for (auto column = 0_col; column.value() < 4; ++column) {
+				EXPECT_NEAR(product.get(row, column), expected.get(row, column), 1e-3f);
+			}
+		}
+	}
+}
+
+TEST_F(SimdAffineTransformProductTest, ProductWithFullMatrixMatchesSimdStorage) {
+	for (auto iteration = 0; iteration < 16; ++iteration) {
+		const auto lhs = random<SimdAffineMatrix>();
+		const auto rhs = random<SimdMatrix>();
+
+		const auto product = lhs * rhs;
+		static_assert(std::is_same_v<decltype(product), const SimdMatrix>);
+
+		const auto expected = SimdMatrix(lhs) * rhs;
+
+		for (auto row = 0_row; row.value() < 4; ++row) {
+			for (auto column = 0_col; column.value() < 4; ++column) {
+				EXPECT_NEAR(product.get(row, column), expected.get(row, column), 1e-3f);
+			}
+		}
+	}
+}
+
+} // anonymous namespace
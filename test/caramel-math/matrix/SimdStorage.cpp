@@ -1,11 +1,18 @@
+#include <limits>
+#include <random>
+
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
 #include "caramel-math/matrix/ThrowingErrorHandler.hpp"
 #include "caramel-math/matrix/SimdStorage.hpp"
+#include "caramel-math/matrix/ArrayStorage.hpp"
+#include "caramel-math/matrix/AffineTransformStorage.hpp"
 #include "caramel-math/matrix/Matrix.hpp"
 #include "caramel-math/scalar/ScalarTraits.hpp"
+#include "caramel-math/scalar/ulp-distance.hpp"
 #include "MockErrorHandler.hpp"
+#include "random-matrix.hpp"
 
 using namespace caramel_math;
 using namespace caramel_math::matrix;
@@ -19,7 +26,7 @@ class SimdStorageTest : public MockErrorHandlerFixtureTest {
 };
 
 TEST_F(SimdStorageTest, IsDefaultConstructible) {
-	auto storage = SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>();
+	[[maybe_unused]] auto storage = SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>();
 }
 
 TEST_F(SimdStorageTest, IsConstructibleWithListOfValues) {
@@ -76,6 +83,439 @@ TEST_F(SimdStorageTest, MatrixMultiplicationWorks) {
 	EXPECT_EQ(product, expected);
 }
 
+TEST_F(SimdStorageTest, MatrixMultiplicationMatchesReferenceImplementationBitForBit) {
+	using Matrix = Matrix<SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+
+	auto generator = std::mt19937(42);
+
+	for (auto iteration = 0; iteration < 64; ++iteration) {
+		const auto lhs = randomMatrix<Matrix>(generator, -100.0f, 100.0f);
+		const auto rhs = randomMatrix<Matrix>(generator, -100.0f, 100.0f);
+		auto referenceLhs = std::array<simd::ReferenceFloat4, 4>();
+		auto referenceRhs = std::array<simd::ReferenceFloat4, 4>();
+
+		for (auto columnIdx = 0_col; columnIdx.value() < 4; ++columnIdx) {
+			referenceLhs[columnIdx.value()] = simd::ReferenceFloat4(lhs.get(columnIdx).xyzw());
+			referenceRhs[columnIdx.value()] = simd::ReferenceFloat4(rhs.get(columnIdx).xyzw());
+		}
+
+		const auto product = lhs * rhs;
+
+		for (auto columnIdx = 0_col; columnIdx.value() < 4; ++columnIdx) {
+			const auto expected = matrix::detail::combineColumns(
+				referenceLhs[0],
+				referenceLhs[1],
+				referenceLhs[2],
+				referenceLhs[3],
+				referenceRhs[columnIdx.value()]
+				).xyzw();
+			const auto actual = product.get(columnIdx).xyzw();
+
+			for (auto rowIdx = 0u; rowIdx < 4u; ++rowIdx) {
+				EXPECT_EQ(ulpDistance(actual[rowIdx], expected[rowIdx]), 0u);
+			}
+		}
+	}
+}
+
+TEST_F(SimdStorageTest, MultiplyPairsMatchesSeparateProductsBitForBit) {
+	using Matrix = Matrix<SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+
+	auto generator = std::mt19937(42);
+
+	for (auto iteration = 0; iteration < 64; ++iteration) {
+		const auto lhs0 = randomMatrix<Matrix>(generator, -100.0f, 100.0f);
+		const auto rhs0 = randomMatrix<Matrix>(generator, -100.0f, 100.0f);
+		const auto lhs1 = randomMatrix<Matrix>(generator, -100.0f, 100.0f);
+		const auto rhs1 = randomMatrix<Matrix>(generator, -100.0f, 100.0f);
+
+		const auto [product0, product1] = multiplyPairs(lhs0, rhs0, lhs1, rhs1);
+		const auto expected0 = lhs0 * rhs0;
+		const auto expected1 = lhs1 * rhs1;
+
+		for (auto row = 0_row; row.value() < 4; ++row) {
+			for (auto column = 0_col; column.value() < 4; ++column) {
+				EXPECT_EQ(ulpDistance(product0.get(row, column), expected0.get(row, column)), 0u);
+				EXPECT_EQ(ulpDistance(product1.get(row, column), expected1.get(row, column)), 0u);
+			}
+		}
+	}
+}
+
+TEST_F(SimdStorageTest, MatricesDifferingByLessThanEpsilonAreEqual) {
+	using Matrix = Matrix<SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+	const auto lhs = Matrix(
+		0.0f, 1.0f, 2.0f, 3.0f,
+		4.0f, 5.0f, 6.0f, 7.0f,
+		8.0f, 9.0f, 10.0f, 11.0f,
+		12.0f, 13.0f, 14.0f, 15.0f
+		);
+
+	for (auto row = 0_row; row.value() < 4; ++row) {
+		for (auto column = 0_col; column.value() < 4; ++column) {
+			auto rhs = lhs;
+
+			rhs.set(row, column, lhs.get(row, column) + BasicScalarTraits<float>::EPSILON * 0.5f);
+			EXPECT_TRUE(lhs == rhs);
+			EXPECT_FALSE(lhs != rhs);
+
+			rhs.set(row, column, lhs.get(row, column) - BasicScalarTraits<float>::EPSILON * 2.0f);
+			EXPECT_FALSE(lhs == rhs);
+			EXPECT_TRUE(lhs != rhs);
+		}
+	}
+}
+
+TEST_F(SimdStorageTest, EqualityWithEpsilonMatchesScalarTraits) {
+	using Matrix = Matrix<SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+	const auto infinity = std::numeric_limits<float>::infinity();
+	const auto values = { 0.0f, 1.0f, -1.0f, infinity, -infinity, std::numeric_limits<float>::quiet_NaN() };
+
+	for (const auto lhsValue : values) {
+		for (const auto rhsValue : values) {
+			auto lhs = Matrix::IDENTITY;
+			auto rhs = Matrix::IDENTITY;
+			lhs.set(1_row, 2_col, lhsValue);
+			rhs.set(1_row, 2_col, rhsValue);
+
+			EXPECT_EQ(lhs == rhs, BasicScalarTraits<float>::equal(lhsValue, rhsValue));
+		}
+	}
+}
+
+TEST_F(SimdStorageTest, StreamStoreWritesColumnMajorValues) {
+	using Matrix = Matrix<SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+	const auto matrix = Matrix(
+		0.0f, 1.0f, 2.0f, 3.0f,
+		4.0f, 5.0f, 6.0f, 7.0f,
+		8.0f, 9.0f, 10.0f, 11.0f,
+		12.0f, 13.0f, 14.0f, 15.0f
+		);
+
+	alignas(simd::Float4::ALIGNMENT) float destination[16] = {};
+	streamStore(matrix, destination);
+	simd::streamFence();
+
+	for (auto row = 0u; row < 4u; ++row) {
+		for (auto column = 0u; column < 4u; ++column) {
+			EXPECT_FLOAT_EQ(destination[column * 4 + row], static_cast<float>(row * 4 + column));
+		}
+	}
+}
+
+TEST_F(SimdStorageTest, DoubleMatrixMultiplicationMatchesArrayStorage) {
+	using SimdMatrix = Matrix<SimdStorage<BasicScalarTraits<double>, ThrowingErrorHandler>>;
+	using ArrayMatrix = Matrix<ArrayStorage<BasicScalarTraits<double>, 4, 4, ThrowingErrorHandler>>;
+
+	auto generator = std::mt19937(42);
+
+	for (auto iteration = 0; iteration < 16; ++iteration) {
+		const auto lhs = randomMatrix<SimdMatrix>(generator, -100.0, 100.0);
+		const auto rhs = randomMatrix<SimdMatrix>(generator, -100.0, 100.0);
+
+		const auto product = lhs * rhs;
+		const auto expected = ArrayMatrix(lhs) * ArrayMatrix(rhs);
+
+		for (auto row = 0_row; row.value() < 4; ++row) {
+			for (auto column = 0_col; column.value() < 4; ++column) {
+				EXPECT_NEAR(product.get(row, column), expected.get(row, column), 1e-9);
+			}
+		}
+	}
+}
+
+TEST_F(SimdStorageTest, ConversionFromAndToArrayStoragePreservesElements) {
+	using SimdMatrix = Matrix<SimdStorage<BasicScalarTraits<double>, ThrowingErrorHandler>>;
+	using ArrayMatrix = Matrix<ArrayStorage<BasicScalarTraits<double>, 4, 4, ThrowingErrorHandler>>;
+	const auto array = ArrayMatrix(
+		0.0, 1.0, 2.0, 3.0,
+		4.0, 5.0, 6.0, 7.0,
+		8.0, 9.0, 10.0, 11.0,
+		12.0, 13.0, 14.0, 15.0
+		);
+
+	const auto simd = SimdMatrix(array);
+	const auto roundTrip = ArrayMatrix(simd);
+
+	for (auto row = 0_row; row.value() < 4; ++row) {
+		for (auto column = 0_col; column.value() < 4; ++column) {
+			EXPECT_EQ(simd.get(row, column), array.get(row, column));
+			EXPECT_EQ(roundTrip.get(row, column), array.get(row, column));
+		}
+	}
+}
+
+TEST_F(SimdStorageTest, ConversionFromAffineTransformStorageYieldsImplicitLastRow) {
+	using SimdMatrix = Matrix<SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+	using AffineMatrix = Matrix<AffineTransformStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+	const auto affine = AffineMatrix(
+		1.0f, 2.0f, 3.0f, 4.0f,
+		5.0f, 6.0f, 7.0f, 8.0f,
+		9.0f, 10.0f, 11.0f, 12.0f
+		);
+
+	const auto simd = SimdMatrix(affine);
+
+	EXPECT_EQ(simd, SimdMatrix(
+		1.0f, 2.0f, 3.0f, 4.0f,
+		5.0f, 6.0f, 7.0f, 8.0f,
+		9.0f, 10.0f, 11.0f, 12.0f,
+		0.0f, 0.0f, 0.0f, 1.0f
+		));
+}
+
+TEST_F(SimdStorageTest, ProductsWithRowMajorMatricesMatchGenericProducts) {
+	using SimdMatrix = Matrix<SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+	using ArrayMatrix = Matrix<ArrayStorage<BasicScalarTraits<float>, 4, 4, ThrowingErrorHandler>>;
+	using AffineMatrix = Matrix<AffineTransformStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+	const auto array = ArrayMatrix(
+		1.0f, -2.0f, 3.0f, 0.0f,
+		4.0f, 5.0f, -6.0f, 1.0f,
+		-7.0f, 8.0f, 9.0f, 2.0f,
+		0.0f, 1.0f, 2.0f, 3.0f
+		);
+	const auto affine = AffineMatrix(
+		2.0f, 0.0f, 1.0f, 3.0f,
+		0.0f, 1.0f, -1.0f, 4.0f,
+		1.0f, 2.0f, 0.0f, -5.0f
+		);
+	const auto simd = SimdMatrix(
+		3.0f, 1.0f, 0.0f, -1.0f,
+		2.0f, -2.0f, 1.0f, 0.0f,
+		0.0f, 4.0f, 1.0f, 2.0f,
+		1.0f, 0.0f, -3.0f, 1.0f
+		);
+	const auto simdAsArray = ArrayMatrix(simd);
+
+	const auto arrayBySimd = array * simd;
+	const auto simdByArray = simd * array;
+	const auto affineBySimd = affine * simd;
+	const auto simdByAffine = simd * affine;
+
+	static_assert(std::is_same_v<std::decay_t<decltype(arrayBySimd)>, ArrayMatrix>);
+	static_assert(std::is_same_v<std::decay_t<decltype(simdByArray)>, ArrayMatrix>);
+	static_assert(std::is_same_v<std::decay_t<decltype(affineBySimd)>, SimdMatrix>);
+	static_assert(std::is_same_v<std::decay_t<decltype(simdByAffine)>, SimdMatrix>);
+
+	EXPECT_EQ(arrayBySimd, array * simdAsArray);
+	EXPECT_EQ(simdByArray, simdAsArray * array);
+	EXPECT_EQ(affineBySimd, ArrayMatrix(affine) * simdAsArray);
+	EXPECT_EQ(simdByAffine, simdAsArray * ArrayMatrix(affine));
+}
+
+TEST_F(SimdStorageTest, ProductsWithTransposedViewsMatchGenericProducts) {
+	using SimdMatrix = Matrix<SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+	using ArrayMatrix = Matrix<ArrayStorage<BasicScalarTraits<float>, 4, 4, ThrowingErrorHandler>>;
+	const auto lhs = SimdMatrix(
+		1.0f, -2.0f, 3.0f, 0.0f,
+		4.0f, 5.0f, -6.0f, 1.0f,
+		-7.0f, 8.0f, 9.0f, 2.0f,
+		0.0f, 1.0f, 2.0f, 3.0f
+		);
+	const auto rhs = SimdMatrix(
+		3.0f, 1.0f, 0.0f, -1.0f,
+		2.0f, -2.0f, 1.0f, 0.0f,
+		0.0f, 4.0f, 1.0f, 2.0f,
+		1.0f, 0.0f, -3.0f, 1.0f
+		);
+	const auto lhsTransposed = ArrayMatrix(transposed(ArrayMatrix(lhs)));
+	const auto rhsTransposed = ArrayMatrix(transposed(ArrayMatrix(rhs)));
+
+	const auto transposedByMatrix = viewTransposed(lhs) * rhs;
+	const auto matrixByTransposed = lhs * viewTransposed(rhs);
+	const auto transposedByTransposed = viewTransposed(lhs) * viewTransposed(rhs);
+
+	static_assert(std::is_same_v<std::decay_t<decltype(transposedByMatrix)>, SimdMatrix>);
+	static_assert(std::is_same_v<std::decay_t<decltype(matrixByTransposed)>, SimdMatrix>);
+	static_assert(std::is_same_v<std::decay_t<decltype(transposedByTransposed)>, SimdMatrix>);
+
+	EXPECT_EQ(transposedByMatrix, lhsTransposed * ArrayMatrix(rhs));
+	EXPECT_EQ(matrixByTransposed, ArrayMatrix(lhs) * rhsTransposed);
+	EXPECT_EQ(transposedByTransposed, lhsTransposed * rhsTransposed);
+}
+
+TEST_F(SimdStorageTest, DoubleMatricesCompareExactly) {
+	using Matrix = Matrix<SimdStorage<BasicScalarTraits<double>, ThrowingErrorHandler>>;
+	const auto lhs = Matrix(
+		0.0, 1.0, 2.0, 3.0,
+		4.0, 5.0, 6.0, 7.0,
+		8.0, 9.0, 10.0, 11.0,
+		12.0, 13.0, 14.0, 15.0
+		);
+
+	auto rhs = lhs;
+	EXPECT_TRUE(lhs == rhs);
+
+	rhs.set(2_row, 1_col, std::nextafter(lhs.get(2_row, 1_col), 100.0));
+	EXPECT_FALSE(lhs == rhs);
+	EXPECT_TRUE(lhs != rhs);
+}
+
+TEST_F(SimdStorageTest, DoubleMatrixTransposedSwapsRowsAndColumns) {
+	using Matrix = Matrix<SimdStorage<BasicScalarTraits<double>, ThrowingErrorHandler>>;
+	const auto matrix = Matrix(
+		0.0, 1.0, 2.0, 3.0,
+		4.0, 5.0, 6.0, 7.0,
+		8.0, 9.0, 10.0, 11.0,
+		12.0, 13.0, 14.0, 15.0
+		);
+
+	const auto transposedMatrix = transposed(matrix);
+
+	for (auto row = 0_row; row.value() < 4; ++row) {
+		for (auto column = 0_col; column.value() < 4; ++column) {
+			EXPECT_DOUBLE_EQ(
+				transposedMatrix.get(row, column),
+				matrix.get(Row(column.value()), Column(row.value()))
+				);
+		}
+	}
+}
+
+TEST_F(SimdStorageTest, TransposeAndTransposedSwapRowsAndColumnsInPlace) {
+	using Matrix = Matrix<SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+	static_assert(matrix::detail::HasTransposeInPlace<Matrix::Storage>::VALUE);
+
+	const auto original = Matrix(
+		0.0f, 1.0f, 2.0f, 3.0f,
+		4.0f, 5.0f, 6.0f, 7.0f,
+		8.0f, 9.0f, 10.0f, 11.0f,
+		12.0f, 13.0f, 14.0f, 15.0f
+		);
+
+	auto transposedInPlace = original;
+	transposedInPlace.transpose();
+	const auto transposedCopy = transposed(original);
+
+	for (auto row = 0_row; row.value() < 4; ++row) {
+		for (auto column = 0_col; column.value() < 4; ++column) {
+			const auto expected = original.get(Row(column.value()), Column(row.value()));
+			EXPECT_FLOAT_EQ(transposedInPlace.get(row, column), expected);
+			EXPECT_FLOAT_EQ(transposedCopy.get(row, column), expected);
+		}
+	}
+}
+
+TEST_F(SimdStorageTest, ScalarMultiplicationAndDivisionScaleEveryElement) {
+	using FloatMatrix = Matrix<SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+	using DoubleMatrix = Matrix<SimdStorage<BasicScalarTraits<double>, ThrowingErrorHandler>>;
+
+	auto floatMatrix = FloatMatrix(
+		0.0f, 1.0f, 2.0f, 3.0f,
+		4.0f, 5.0f, 6.0f, 7.0f,
+		8.0f, 9.0f, 10.0f, 11.0f,
+		12.0f, 13.0f, 14.0f, 15.0f
+		);
+	auto doubleMatrix = DoubleMatrix(
+		0.0, 1.0, 2.0, 3.0,
+		4.0, 5.0, 6.0, 7.0,
+		8.0, 9.0, 10.0, 11.0,
+		12.0, 13.0, 14.0, 15.0
+		);
+
+	floatMatrix *= 4.0f;
+	doubleMatrix *= 4.0;
+
+	for (auto row = 0_row; row.value() < 4; ++row) {
+		for (auto column = 0_col; column.value() < 4; ++column) {
+			const auto expected = static_cast<float>(row.value() * 4 + column.value()) * 4.0f;
+			EXPECT_FLOAT_EQ(floatMatrix.get(row, column), expected);
+			EXPECT_DOUBLE_EQ(doubleMatrix.get(row, column), static_cast<double>(expected));
+		}
+	}
+
+	floatMatrix /= 2.0f;
+	doubleMatrix /= 2.0;
+
+	for (auto row = 0_row; row.value() < 4; ++row) {
+		for (auto column = 0_col; column.value() < 4; ++column) {
+			const auto expected = static_cast<float>(row.value() * 4 + column.value()) * 2.0f;
+			EXPECT_FLOAT_EQ(floatMatrix.get(row, column), expected);
+			EXPECT_DOUBLE_EQ(doubleMatrix.get(row, column), static_cast<double>(expected));
+		}
+	}
+}
+
+TEST_F(SimdStorageTest, DeterminantAndInverseMatchGenericImplementation) {
+	using SimdMatrix = Matrix<SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+	using ArrayMatrix = Matrix<ArrayStorage<BasicScalarTraits<float>, 4, 4, ThrowingErrorHandler>>;
+
+	auto generator = std::mt19937(42);
+
+	for (auto iteration = 0; iteration < 64; ++iteration) {
+		const auto simdMatrix = randomMatrix<SimdMatrix>(generator, -10.0f, 10.0f);
+		const auto arrayMatrix = ArrayMatrix(simdMatrix);
+
+		const auto expectedDeterminant = determinant(arrayMatrix);
+		EXPECT_NEAR(determinant(simdMatrix), expectedDeterminant, std::abs(expectedDeterminant) * 1e-4f);
+
+		const auto simdInverse = inverse(simdMatrix);
+		const auto arrayInverse = inverse(arrayMatrix);
+		ASSERT_TRUE(simdInverse);
+		ASSERT_TRUE(arrayInverse);
+
+		const auto identity = *simdInverse * simdMatrix;
+		for (auto row = 0_row; row.value() < 4; ++row) {
+			for (auto column = 0_col; column.value() < 4; ++column) {
+				const auto expected = arrayInverse->get(row, column);
+				EXPECT_NEAR(simdInverse->get(row, column), expected, std::abs(expected) * 1e-3f + 1e-4f);
+				EXPECT_NEAR(identity.get(row, column), (row.value() == column.value()) ? 1.0f : 0.0f, 1e-3f);
+			}
+		}
+	}
+}
+
+TEST_F(SimdStorageTest, InverseOfSingularMatrixIsEmpty) {
+	using Matrix = Matrix<SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+	const auto singular = Matrix(
+		1.0f, 2.0f, 3.0f, 4.0f,
+		2.0f, 4.0f, 6.0f, 8.0f,
+		0.0f, 1.0f, 0.0f, 1.0f,
+		5.0f, 3.0f, 1.0f, 2.0f
+		);
+
+	EXPECT_FLOAT_EQ(determinant(singular), 0.0f);
+	EXPECT_FALSE(inverse(singular));
+}
+
+TEST_F(SimdStorageTest, InverseMatchesReferenceImplementationBitForBit) {
+	using Matrix = Matrix<SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+
+	auto generator = std::mt19937(42);
+
+	for (auto iteration = 0; iteration < 64; ++iteration) {
+		const auto matrix = randomMatrix<Matrix>(generator, -10.0f, 10.0f);
+		auto columns = std::array<simd::Float4, 4>();
+		auto referenceColumns = std::array<simd::ReferenceFloat4, 4>();
+		for (auto columnIdx = 0_col; columnIdx.value() < 4; ++columnIdx) {
+			columns[columnIdx.value()] = matrix.get(columnIdx);
+			referenceColumns[columnIdx.value()] = simd::ReferenceFloat4(columns[columnIdx.value()].xyzw());
+		}
+
+		const auto blocks = matrix::detail::BlockDecomposition4x4<simd::Float4>(
+			columns[0], columns[1], columns[2], columns[3]);
+		const auto referenceBlocks = matrix::detail::BlockDecomposition4x4<simd::ReferenceFloat4>(
+			referenceColumns[0], referenceColumns[1], referenceColumns[2], referenceColumns[3]);
+
+		EXPECT_EQ(
+			ulpDistance(blocks.determinant.extractLane<0>(), referenceBlocks.determinant.extractLane<0>()),
+			0u
+			);
+
+		matrix::detail::invert4x4(blocks, columns[0], columns[1], columns[2], columns[3]);
+		matrix::detail::invert4x4(
+			referenceBlocks, referenceColumns[0], referenceColumns[1], referenceColumns[2], referenceColumns[3]);
+
+		for (auto columnIdx = 0u; columnIdx < 4u; ++columnIdx) {
+			const auto actual = columns[columnIdx].xyzw();
+			const auto expected = referenceColumns[columnIdx].xyzw();
+			for (auto rowIdx = 0u; rowIdx < 4u; ++rowIdx) {
+				EXPECT_EQ(ulpDistance(actual[rowIdx], expected[rowIdx]), 0u);
+			}
+		}
+	}
+}
+
 TEST_F(SimdStorageTest, ArrayStorageIsCopyable) {
 	using Storage = SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>;
 	const auto storage = Storage(
@@ -113,6 +553,40 @@ TEST_F(SimdStorageTest, GetAndSetReturnAndUpdateStoredValue) {
 	EXPECT_FLOAT_EQ(storage.get(0_row, 1_col), 666.0f);
 }
 
+TEST_F(SimdStorageTest, SetUpdatesOnlyTheAddressedElement) {
+	using FloatStorage = SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>;
+	using DoubleStorage = SimdStorage<BasicScalarTraits<double>, ThrowingErrorHandler>;
+
+	for (auto row = 0_row; row.value() < 4; ++row) {
+		for (auto column = 0_col; column.value() < 4; ++column) {
+			auto floatStorage = FloatStorage(
+				0.0f, 1.0f, 2.0f, 3.0f,
+				4.0f, 5.0f, 6.0f, 7.0f,
+				8.0f, 9.0f, 10.0f, 11.0f,
+				12.0f, 13.0f, 14.0f, 15.0f
+				);
+			auto doubleStorage = DoubleStorage(
+				0.0, 1.0, 2.0, 3.0,
+				4.0, 5.0, 6.0, 7.0,
+				8.0, 9.0, 10.0, 11.0,
+				12.0, 13.0, 14.0, 15.0
+				);
+
+			floatStorage.set(row, column, -1.0f);
+			doubleStorage.set(row, column, -1.0);
+
+			for (auto readRow = 0_row; readRow.value() < 4; ++readRow) {
+				for (auto readColumn = 0_col; readColumn.value() < 4; ++readColumn) {
+					const auto written = (readRow.value() == row.value() && readColumn.value() == column.value());
+					const auto expected = written ? -1.0f : static_cast<float>(readRow.value() * 4 + readColumn.value());
+					EXPECT_FLOAT_EQ(floatStorage.get(readRow, readColumn), expected);
+					EXPECT_DOUBLE_EQ(doubleStorage.get(readRow, readColumn), static_cast<double>(expected));
+				}
+			}
+		}
+	}
+}
+
 TEST_F(SimdStorageTest, GetAndSetReturnAndUpdateStoredColumn) {
 	auto storage = SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>();
 	storage.set(1_col, simd::Float4({ 0.0f, 1.0f, 2.0f, 3.0f }));
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include "caramel-math/matrix/multiply-chain.hpp"
+
+#include "caramel-math/matrix/ArrayStorage.hpp"
+#include "caramel-math/matrix/SimdStorage.hpp"
+#include "caramel-math/matrix/ThrowingErrorHandler.hpp"
+#include "caramel-math/scalar/ScalarTraits.hpp"
+#include "sequence-matrix.hpp"
+
+using namespace caramel_math;
+using namespace caramel_math::matrix;
+using namespace caramel_math::scalar;
+using namespace caramel_math::matrix::literals;
+using namespace caramel_math::matrix::test;
+
+namespace /* anonymous */ {
+
+template <size_t ROWS, size_t COLUMNS>
+using ArrayMatrix = Matrix<ArrayStorage<BasicScalarTraits<double>, ROWS, COLUMNS, ThrowingErrorHandler>>;
+
+TEST(MultiplyChainTest, OptimalChainOrderMinimizesMultiplications) {
+	constexpr auto threeMatrices = matrix::detail::optimalChainOrder<3>({ 3, 8, 8, 1 });
+	static_assert(threeMatrices.split[0][2] == 0);
+	static_assert(threeMatrices.cost[0][2] == 88);
+
+	// Textbook example: 30x35, 35x15, 15x5, 5x10, 10x20, 20x25 is best computed as (A (B C)) ((D E) F).
+	constexpr auto sixMatrices = matrix::detail::optimalChainOrder<6>({ 30, 35, 15, 5, 10, 20, 25 });
+	static_assert(sixMatrices.cost[0][5] == 15125);
+	static_assert(sixMatrices.split[0][5] == 2);
+	static_assert(sixMatrices.split[0][2] == 0);
+	static_assert(sixMatrices.split[3][5] == 4);
+}
+
+TEST(MultiplyChainTest, MultiplyChainYieldsProductOfMatrices) {
+	const auto a = sequenceMatrix<ArrayMatrix<3, 8>>(1.0);
+	const auto b = sequenceMatrix<ArrayMatrix<8, 8>>(-2.0);
+	const auto c = sequenceMatrix<ArrayMatrix<8, 1>>(0.5);
+	const auto d = sequenceMatrix<ArrayMatrix<1, 4>>(3.0);
+
+	const auto product = multiplyChain(a, b, c, d);
+
+	static_assert(std::is_same_v<std::decay_t<decltype(product)>, ArrayMatrix<3, 4>>);
+	EXPECT_EQ(product, a * b * c * d);
+	EXPECT_EQ(multiplyChain(a, b, c), a * (b * c));
+	EXPECT_EQ(multiplyChain(a), a);
+}
+
+TEST(MultiplyChainTest, MultiplyChainUsesSpecializedProducts) {
+	using SimdMatrix = Matrix<SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+	const auto a = SimdMatrix(ArrayMatrix<4, 4>(sequenceMatrix<ArrayMatrix<4, 4>>(1.0)));
+	const auto b = SimdMatrix(ArrayMatrix<4, 4>(sequenceMatrix<ArrayMatrix<4, 4>>(-1.0)));
+
+	const auto product = multiplyChain(a, b, a);
+
+	static_assert(std::is_same_v<std::decay_t<decltype(product)>, SimdMatrix>);
+	EXPECT_EQ(product, a * b * a);
+}
+
+} // anonymous namespace
@@ -0,0 +1,39 @@
+#ifndef CARAMELMATH_TEST_MATRIX_RANDOMMATRIX_HPP__
+#define CARAMELMATH_TEST_MATRIX_RANDOMMATRIX_HPP__
+
+#include <random>
+
+#include "caramel-math/matrix/matrix-coordinates.hpp"
+#include "caramel-math/matrix/storage-traits.hpp"
+
+namespace caramel_math::matrix::test {
+
+// Returns a matrix with elements drawn uniformly from [min, max), in row-major order. The implicit last row of
+// affine transform storages is left as is.
+template <class MatrixType, class GeneratorType>
+MatrixType randomMatrix(
+	GeneratorType& generator,
+	typename MatrixType::Scalar min,
+	typename MatrixType::Scalar max
+	)
+{
+	using Scalar = typename MatrixType::Scalar;
+
+	constexpr auto ROWS = matrix::detail::IsAffineTransformStorage<typename MatrixType::Storage>::VALUE ?
+		MatrixType::ROWS - 1 :
+		MatrixType::ROWS;
+
+	auto distribution = std::uniform_real_distribution<Scalar>(min, max);
+
+	auto matrix = MatrixType();
+	for (auto row = Row(0); row.value() < ROWS; ++row) {
+		for (auto column = Column(0); column.value() < MatrixType::COLUMNS; ++column) {
+			matrix.set(row, column, distribution(generator));
+		}
+	}
+	return matrix;
+}
+
+} // namespace caramel_math::matrix::test
+
+#endif /* CARAMELMATH_TEST_MATRIX_RANDOMMATRIX_HPP__ */
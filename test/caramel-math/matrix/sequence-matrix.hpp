@@ -0,0 +1,24 @@
+#ifndef CARAMELMATH_TEST_MATRIX_SEQUENCEMATRIX_HPP__
+#define CARAMELMATH_TEST_MATRIX_SEQUENCEMATRIX_HPP__
+
+#include "caramel-math/matrix/matrix-coordinates.hpp"
+
+namespace caramel_math::matrix::test {
+
+// Returns the matrix with elements offset, offset + 1, offset + 2 and so on, in row-major order.
+template <class MatrixType>
+MatrixType sequenceMatrix(typename MatrixType::Scalar offset) {
+	using Scalar = typename MatrixType::Scalar;
+
+	auto matrix = MatrixType();
+	for (auto row = Row(0); row.value() < MatrixType::ROWS; ++row) {
+		for (auto column = Column(0); column.value() < MatrixType::COLUMNS; ++column) {
+			matrix.set(row, column, offset + static_cast<Scalar>(row.value() * MatrixType::COLUMNS + column.value()));
+		}
+	}
+	return matrix;
+}
+
+} // namespace caramel_math::matrix::test
+
+#endif /* CARAMELMATH_TEST_MATRIX_SEQUENCEMATRIX_HPP__ */
@@ -0,0 +1,146 @@
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "caramel-math/matrix/ThrowingErrorHandler.hpp"
+#include "caramel-math/matrix/simd-dispatch.hpp"
+#include "caramel-math/matrix/Matrix.hpp"
+#include "caramel-math/scalar/ScalarTraits.hpp"
+#include "caramel-math/scalar/ulp-distance.hpp"
+#include "random-matrix.hpp"
+
+using namespace caramel_math;
+using namespace caramel_math::matrix;
+using namespace caramel_math::scalar;
+using namespace caramel_math::matrix::literals;
+using namespace caramel_math::matrix::test;
+
+namespace /* anonymous */ {
+
+using SimdMatrix = Matrix<SimdStorage<BasicScalarTraits<float>, ThrowingErrorHandler>>;
+
+class SimdDispatchTest : public testing::TestWithParam<simd::InstructionSet> {
+public:
+
+	void TearDown() override {
+		simd::limitInstructionSet(simd::InstructionSet::AVX512);
+	}
+
+	static std::vector<SimdMatrix> randomMatrices(size_t count, unsigned int seed) {
+		auto generator = std::mt19937(seed);
+
+		auto matrices = std::vector<SimdMatrix>();
+		matrices.reserve(count);
+		for (auto index = size_t(0); index < count; ++index) {
+			matrices.push_back(randomMatrix<SimdMatrix>(generator, -10.0f, 10.0f));
+		}
+
+		return matrices;
+	}
+
+	// Fused multiply-adds round once instead of twice, so allow for a few ulps or a small absolute error
+	// where the result cancels out.
+	static void expectClose(const SimdMatrix& actual, const SimdMatrix& expected) {
+		for (auto row = 0_row; row.value() < 4; ++row) {
+			for (auto column = 0_col; column.value() < 4; ++column) {
+				const auto actualValue = actual.get(row, column);
+				const auto expectedValue = expected.get(row, column);
+				if (ulpDistance(actualValue, expectedValue) > 4u) {
+					EXPECT_NEAR(actualValue, expectedValue, 1e-4f);
+				}
+			}
+		}
+	}
+
+};
+
+TEST_P(SimdDispatchTest, KernelsMatchOperatorMultiply) {
+	if (GetParam() > simd::detectInstructionSet()) {
+		return;
+	}
+
+	const auto kernels = dispatch::simdKernels<SimdMatrix>(GetParam());
+
+	// odd count, so paths processing two or four products at once also handle the remainder
+	const auto count = size_t(7);
+	const auto lhs = randomMatrices(count, 1);
+	const auto rhs = randomMatrices(count, 2);
+	auto batchResult = std::vector<SimdMatrix>(count);
+	kernels.multiplyBatch(lhs.data(), rhs.data(), batchResult.data(), count);
+
+	for (auto i = size_t(0); i < count; ++i) {
+		const auto expected = lhs[i] * rhs[i];
+		expectClose(kernels.multiply(lhs[i], rhs[i]), expected);
+		expectClose(batchResult[i], expected);
+	}
+}
+
+TEST_P(SimdDispatchTest, InverseKernelMatchesInverse) {
+	if (GetParam() > simd::detectInstructionSet()) {
+		return;
+	}
+
+	const auto kernels = dispatch::simdKernels<SimdMatrix>(GetParam());
+
+	for (const auto& matrix : randomMatrices(7, 5)) {
+		const auto expected = inverse(matrix);
+		const auto actual = kernels.inverse(matrix);
+		ASSERT_TRUE(expected.has_value());
+		ASSERT_TRUE(actual.has_value());
+		expectClose(*actual, *expected);
+	}
+
+	const auto singular = SimdMatrix(
+		1.0f, 2.0f, 3.0f, 4.0f,
+		2.0f, 4.0f, 6.0f, 8.0f,
+		0.0f, 1.0f, 0.0f, 1.0f,
+		1.0f, 0.0f, 1.0f, 0.0f
+		);
+	EXPECT_FALSE(kernels.inverse(singular).has_value());
+}
+
+TEST_P(SimdDispatchTest, LimitSelectsKernelsOfLowerTier) {
+	simd::limitInstructionSet(GetParam());
+
+	const auto lhs = randomMatrices(3, 3);
+	const auto rhs = randomMatrices(3, 4);
+	auto result = std::vector<SimdMatrix>(3);
+	dispatch::multiplyBatch(lhs.data(), rhs.data(), result.data(), 3);
+
+	const auto expected = dispatch::simdKernels<SimdMatrix>(simd::activeInstructionSet()).multiply(lhs[0], rhs[0]);
+	const auto actual = dispatch::multiply(lhs[0], rhs[0]);
+	for (auto row = 0_row; row.value() < 4; ++row) {
+		for (auto column = 0_col; column.value() < 4; ++column) {
+			EXPECT_EQ(actual.get(row, column), expected.get(row, column));
+		}
+	}
+
+	for (auto i = size_t(0); i < 3; ++i) {
+		expectClose(result[i], lhs[i] * rhs[i]);
+	}
+
+	const auto expectedInverse = dispatch::simdKernels<SimdMatrix>(simd::activeInstructionSet()).inverse(lhs[0]);
+	const auto actualInverse = dispatch::inverse(lhs[0]);
+	ASSERT_TRUE(expectedInverse.has_value());
+	ASSERT_TRUE(actualInverse.has_value());
+	for (auto row = 0_row; row.value() < 4; ++row) {
+		for (auto column = 0_col; column.value() < 4; ++column) {
+			EXPECT_EQ(actualInverse->get(row, column), expectedInverse->get(row, column));
+		}
+	}
+}
+
+INSTANTIATE_TEST_CASE_P(
+	AllInstructionSets,
+	SimdDispatchTest,
+	testing::Values(
+		simd::InstructionSet::REFERENCE,
+		simd::InstructionSet::SSE2,
+		simd::InstructionSet::SSE4_1,
+		simd::InstructionSet::AVX2,
+		simd::InstructionSet::AVX512
+		)
+	);
+
+} // anonymous namespace
@@ -5,6 +5,8 @@
 #include "caramel-math/matrix/Matrix.hpp"
 #include "caramel-math/matrix/ViewStorage.hpp"
 #include "caramel-math/matrix/ArrayStorage.hpp"
+#include "caramel-math/matrix/AffineTransformStorage.hpp"
+#include "caramel-math/matrix/SimdStorage.hpp"
 #include "caramel-math/matrix/AssertErrorHandler.hpp"
 #include "caramel-math/scalar/ScalarTraits.hpp"
 
@@ -61,4 +63,61 @@ TEST(StorageTraitsTest, BinaryOperatorResultTypeWithSameStorageTypesIsTheStorage
 	static_assert(std::is_same_v<BinaryOperatorResultType<NullStorage, NullStorage, 0, 0>, NullStorage>);
 }
 
+TEST(StorageTraitsTest, ContiguousLayoutIsPublishedByOptingInStorages) {
+	using ArrayStorage = ArrayStorage<BasicScalarTraits<float>, 4, 4, AssertErrorHandler>;
+	using AffineStorage = AffineTransformStorage<BasicScalarTraits<float>, AssertErrorHandler>;
+	using SimdStorage = SimdStorage<BasicScalarTraits<float>, AssertErrorHandler>;
+	using ViewStorage = SubmatrixViewStorage<Matrix<ArrayStorage>>;
+
+	struct DerivedStorage : ArrayStorage {
+	};
+
+	static_assert(matrix::detail::HasContiguousLayout<ArrayStorage>::VALUE);
+	static_assert(matrix::detail::HasContiguousLayout<AffineStorage>::VALUE);
+	static_assert(matrix::detail::HasContiguousLayout<SimdStorage>::VALUE);
+	static_assert(!matrix::detail::HasContiguousLayout<ViewStorage>::VALUE);
+	static_assert(!matrix::detail::HasContiguousLayout<DerivedStorage>::VALUE);
+	static_assert(!matrix::detail::HasContiguousLayout<NullStorage>::VALUE);
+
+	static_assert(matrix::detail::HasDenseLayout<ArrayStorage>::VALUE);
+	static_assert(!matrix::detail::HasDenseLayout<AffineStorage>::VALUE);
+	static_assert(matrix::detail::HasDenseLayout<SimdStorage>::VALUE);
+}
+
+TEST(StorageTraitsTest, SameDenseLayoutRequiresEqualStridesAndScalars) {
+	using FloatArrayStorage = ArrayStorage<BasicScalarTraits<float>, 4, 4, AssertErrorHandler>;
+	using DoubleArrayStorage = ArrayStorage<BasicScalarTraits<double>, 4, 4, AssertErrorHandler>;
+	using SimdStorage = SimdStorage<BasicScalarTraits<float>, AssertErrorHandler>;
+
+	static_assert(matrix::detail::HaveSameDenseLayout<FloatArrayStorage, FloatArrayStorage>::VALUE);
+	static_assert(!matrix::detail::HaveSameDenseLayout<FloatArrayStorage, DoubleArrayStorage>::VALUE);
+	static_assert(!matrix::detail::HaveSameDenseLayout<FloatArrayStorage, SimdStorage>::VALUE);
+}
+
+TEST(StorageTraitsTest, TransposedViewsOfDenseStoragesHaveTransposedDenseLayout) {
+	using ArrayStorage = ArrayStorage<BasicScalarTraits<float>, 2, 4, AssertErrorHandler>;
+	using AffineStorage = AffineTransformStorage<BasicScalarTraits<float>, AssertErrorHandler>;
+	using SimdStorage = SimdStorage<BasicScalarTraits<float>, AssertErrorHandler>;
+	using ArrayViewStorage = TransposedViewStorage<const Matrix<ArrayStorage>>;
+	using SimdViewStorage = TransposedViewStorage<Matrix<SimdStorage>>;
+
+	static_assert(matrix::detail::HaveTransposedDenseLayout<ArrayViewStorage, ArrayStorage>::VALUE);
+	static_assert(matrix::detail::HaveTransposedDenseLayout<SimdViewStorage, SimdStorage>::VALUE);
+	static_assert(ArrayViewStorage::MAJOR_ORDER == MajorOrder::COLUMN);
+	static_assert(SimdViewStorage::MAJOR_ORDER == MajorOrder::ROW);
+	static_assert(!matrix::detail::HasContiguousLayout<TransposedViewStorage<Matrix<AffineStorage>>>::VALUE);
+}
+
+TEST(StorageTraitsTest, TransposedStorageTypeOfArrayStorageFlipsMajorOrder) {
+	using RowMajorStorage = ArrayStorage<BasicScalarTraits<float>, 2, 4, AssertErrorHandler>;
+	using ColumnMajorStorage = ArrayStorage<BasicScalarTraits<float>, 4, 2, AssertErrorHandler, MajorOrder::COLUMN>;
+	using SimdStorage = SimdStorage<BasicScalarTraits<float>, AssertErrorHandler>;
+
+	static_assert(std::is_same_v<TransposedStorageType<RowMajorStorage>, ColumnMajorStorage>);
+	static_assert(std::is_same_v<TransposedStorageType<ColumnMajorStorage>, RowMajorStorage>);
+	static_assert(matrix::detail::HaveTransposedDenseLayout<ColumnMajorStorage, RowMajorStorage>::VALUE);
+	static_assert(!matrix::detail::HaveTransposedDenseLayout<RowMajorStorage, RowMajorStorage>::VALUE);
+	static_assert(!matrix::detail::HaveTransposedDenseLayout<SimdStorage, SimdStorage>::VALUE);
+}
+
 } // anonymous namespace
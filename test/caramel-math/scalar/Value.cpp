@@ -79,7 +79,6 @@ TEST(ValueTest, ValuesAreIncrementableAndDecrementable) {
 
 TEST(ValueTest, ValuesAreMultiplicative) {
 	constexpr auto three = SomeValue(3);
-	constexpr auto four = SomeValue(4);
 	constexpr auto twelve = SomeValue(12);
 
 	auto threeTimesEqFour = three;
@@ -0,0 +1,38 @@
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "caramel-math/scalar/ulp-distance.hpp"
+
+using namespace caramel_math::scalar;
+
+namespace /* anonymous */ {
+
+TEST(UlpDistanceTest, YieldsZeroForIdenticalValues) {
+	EXPECT_EQ(ulpDistance(1.0f, 1.0f), 0u);
+	EXPECT_EQ(ulpDistance(0.0f, -0.0f), 0u);
+	EXPECT_EQ(ulpDistance(std::nanf(""), std::nanf("")), 0u);
+}
+
+TEST(UlpDistanceTest, CountsRepresentableFloatsBetweenValues) {
+	EXPECT_EQ(ulpDistance(1.0f, std::nextafter(1.0f, 2.0f)), 1u);
+	EXPECT_EQ(ulpDistance(std::nextafter(1.0f, 2.0f), 1.0f), 1u);
+	EXPECT_EQ(ulpDistance(std::nextafter(0.0f, 1.0f), std::nextafter(0.0f, -1.0f)), 2u);
+}
+
+TEST(UlpDistanceTest, YieldsMaximumDistanceIfOnlyOneValueIsNan) {
+	EXPECT_EQ(ulpDistance(std::nanf(""), 1.0f), std::numeric_limits<std::uint32_t>::max());
+	EXPECT_EQ(ulpDistance(1.0f, std::nanf("")), std::numeric_limits<std::uint32_t>::max());
+}
+
+TEST(UlpDistanceTest, CountsRepresentableDoublesBetweenValues) {
+	EXPECT_EQ(ulpDistance(1.0, 1.0), 0u);
+	EXPECT_EQ(ulpDistance(0.0, -0.0), 0u);
+	EXPECT_EQ(ulpDistance(1.0, std::nextafter(1.0, 2.0)), 1u);
+	EXPECT_EQ(ulpDistance(std::nextafter(0.0, 1.0), std::nextafter(0.0, -1.0)), 2u);
+	EXPECT_EQ(ulpDistance(std::nan(""), 1.0), std::numeric_limits<std::uint64_t>::max());
+}
+
+} // anonymous namespace
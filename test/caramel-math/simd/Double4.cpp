@@ -0,0 +1,147 @@
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "caramel-math/simd/Double4.hpp"
+#include "caramel-math/scalar/ulp-distance.hpp"
+
+using namespace caramel_math::simd;
+using namespace caramel_math::scalar;
+
+namespace /* anonymous */ {
+
+template <class Double4Type>
+class Double4Test : public testing::Test {
+};
+
+using Double4Types = testing::Types<Double4, ReferenceDouble4>;
+
+TYPED_TEST_CASE(Double4Test, Double4Types);
+
+TYPED_TEST(Double4Test, InitialisationAndReadAccessWorks) {
+	const auto xyzw = TypeParam({ 0.0, 1.0, 2.0, 3.0 }).xyzw();
+	EXPECT_DOUBLE_EQ(xyzw[0], 0.0);
+	EXPECT_DOUBLE_EQ(xyzw[1], 1.0);
+	EXPECT_DOUBLE_EQ(xyzw[2], 2.0);
+	EXPECT_DOUBLE_EQ(xyzw[3], 3.0);
+
+	const auto replicated = TypeParam(42.0).xyzw();
+	for (auto lane = 0u; lane < 4u; ++lane) {
+		EXPECT_DOUBLE_EQ(replicated[lane], 42.0);
+	}
+}
+
+TYPED_TEST(Double4Test, ArithmeticWorksLaneWise) {
+	const auto lhs = TypeParam({ 0.0, 1.0, 2.0, 3.0 });
+	const auto rhs = TypeParam({ 1.0, 2.0, 4.0, 8.0 });
+
+	const auto sum = (lhs + rhs).xyzw();
+	const auto difference = (lhs - rhs).xyzw();
+	const auto product = (lhs * rhs).xyzw();
+	const auto quotient = (lhs / rhs).xyzw();
+	const auto multipliedAdded = madd(lhs, rhs, rhs).xyzw();
+
+	EXPECT_DOUBLE_EQ(sum[3], 11.0);
+	EXPECT_DOUBLE_EQ(difference[2], -2.0);
+	EXPECT_DOUBLE_EQ(product[1], 2.0);
+	EXPECT_DOUBLE_EQ(quotient[3], 0.375);
+	EXPECT_DOUBLE_EQ(multipliedAdded[2], 12.0);
+}
+
+TYPED_TEST(Double4Test, ShuffleReordersAcrossAllLanes) {
+	const auto d4 = TypeParam({ 0.0, 1.0, 2.0, 3.0 });
+
+	const auto shuffled = d4.template shuffle<3, 0, 2, 1>().xyzw();
+	EXPECT_DOUBLE_EQ(shuffled[0], 3.0);
+	EXPECT_DOUBLE_EQ(shuffled[1], 0.0);
+	EXPECT_DOUBLE_EQ(shuffled[2], 2.0);
+	EXPECT_DOUBLE_EQ(shuffled[3], 1.0);
+
+	const auto broadcast = d4.template broadcastLane<2>().xyzw();
+	for (auto lane = 0u; lane < 4u; ++lane) {
+		EXPECT_DOUBLE_EQ(broadcast[lane], 2.0);
+	}
+
+	EXPECT_DOUBLE_EQ(d4.template extractLane<1>(), 1.0);
+	EXPECT_DOUBLE_EQ(d4.template extractLane<3>(), 3.0);
+}
+
+TYPED_TEST(Double4Test, InsertLaneReplacesOnlyThatLane) {
+	const auto d4 = TypeParam({ 0.0, 1.0, 2.0, 3.0 });
+
+	const std::array<double, 4> inserted[] = {
+		d4.template insertLane<0>(42.0).xyzw(),
+		d4.template insertLane<1>(42.0).xyzw(),
+		d4.template insertLane<2>(42.0).xyzw(),
+		d4.template insertLane<3>(42.0).xyzw()
+		};
+	for (auto insertedLane = 0u; insertedLane < 4u; ++insertedLane) {
+		for (auto lane = 0u; lane < 4u; ++lane) {
+			const auto expected = (lane == insertedLane) ? 42.0 : static_cast<double>(lane);
+			EXPECT_DOUBLE_EQ(inserted[insertedLane][lane], expected);
+		}
+	}
+}
+
+TYPED_TEST(Double4Test, MathComparisonsAndHorizontalOperationsWork) {
+	const auto lhs = TypeParam({ -4.0, 1.0, 9.0, 16.0 });
+	const auto rhs = TypeParam(1.0);
+
+	EXPECT_DOUBLE_EQ(sqrt(abs(lhs)).template extractLane<0>(), 2.0);
+	EXPECT_DOUBLE_EQ(min(lhs, rhs).template extractLane<3>(), 1.0);
+	EXPECT_DOUBLE_EQ(max(lhs, rhs).template extractLane<0>(), 1.0);
+	EXPECT_DOUBLE_EQ(horizontalAdd(lhs).template extractLane<2>(), 22.0);
+	EXPECT_DOUBLE_EQ(dot(lhs, rhs).template extractLane<1>(), 22.0);
+
+	EXPECT_EQ(movemask(cmpLt(lhs, rhs)), 0x1);
+	EXPECT_EQ(movemask(cmpLe(lhs, rhs) | cmpEq(lhs, TypeParam(16.0))), 0xb);
+	EXPECT_DOUBLE_EQ(select(cmpLt(lhs, rhs), rhs, lhs).template extractLane<0>(), 1.0);
+}
+
+TYPED_TEST(Double4Test, TransposeSwapsRowsAndColumns) {
+	auto c0 = TypeParam({ 0.0, 1.0, 2.0, 3.0 });
+	auto c1 = TypeParam({ 4.0, 5.0, 6.0, 7.0 });
+	auto c2 = TypeParam({ 8.0, 9.0, 10.0, 11.0 });
+	auto c3 = TypeParam({ 12.0, 13.0, 14.0, 15.0 });
+
+	transpose(c0, c1, c2, c3);
+
+	const TypeParam columns[] = { c0, c1, c2, c3 };
+	for (auto column = 0u; column < 4u; ++column) {
+		const auto xyzw = columns[column].xyzw();
+		for (auto row = 0u; row < 4u; ++row) {
+			EXPECT_DOUBLE_EQ(xyzw[row], static_cast<double>(row * 4 + column));
+		}
+	}
+}
+
+// --- validation of the native implementation against the reference implementation
+
+TEST(Double4ValidationTest, NativeOperationsMatchReferenceBitForBit) {
+	auto generator = std::mt19937(42);
+	auto distribution = std::uniform_real_distribution<double>(-1000.0, 1000.0);
+	auto randomXyzw = [&]() {
+			return std::array<double, 4>{
+				distribution(generator), distribution(generator), distribution(generator), distribution(generator)
+				};
+		};
+
+	auto operation = [](auto lhs, auto rhs) {
+			const auto combined = madd(lhs.template shuffle<2, 3, 1, 0>(), rhs, lhs / rhs);
+			return select(cmpLt(lhs, rhs), sqrt(abs(combined)), max(combined, dot(lhs, rhs)));
+		};
+
+	for (auto iteration = 0; iteration < 128; ++iteration) {
+		const auto lhs = randomXyzw();
+		const auto rhs = randomXyzw();
+
+		const auto native = operation(Double4(lhs), Double4(rhs)).xyzw();
+		const auto reference = operation(ReferenceDouble4(lhs), ReferenceDouble4(rhs)).xyzw();
+
+		for (auto lane = 0u; lane < 4u; ++lane) {
+			EXPECT_EQ(ulpDistance(native[lane], reference[lane]), 0u);
+		}
+	}
+}
+
+} // anonymous namespace
@@ -1,14 +1,28 @@
+#include <cmath>
+#include <random>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "caramel-math/simd/Float4.hpp"
+#include "caramel-math/scalar/ulp-distance.hpp"
 
 using namespace caramel_math::simd;
+using namespace caramel_math::scalar;
 
 namespace /* anonymous */ {
 
-TEST(Float4Test, InitialisationAndReadAccessWorks) {
+template <class Float4Type>
+class Float4Test : public testing::Test {
+};
+
+using Float4Types = testing::Types<Float4, ReferenceFloat4>;
+
+TYPED_TEST_CASE(Float4Test, Float4Types);
+
+TYPED_TEST(Float4Test, InitialisationAndReadAccessWorks) {
 	{
-		auto f4 = Float4({ 0.0f, 1.0f, 2.0f, 3.0f });
+		auto f4 = TypeParam({ 0.0f, 1.0f, 2.0f, 3.0f });
 		const auto xyzw = f4.xyzw();
 
 		EXPECT_FLOAT_EQ(xyzw[0], 0.0f);
@@ -18,7 +32,7 @@ TEST(Float4Test, InitialisationAndReadAccessWorks) {
 	}
 
 	{
-		auto f4 = Float4(42.0f);
+		auto f4 = TypeParam(42.0f);
 		const auto xyzw = f4.xyzw();
 
 		EXPECT_FLOAT_EQ(xyzw[0], 42.0f);
@@ -28,9 +42,9 @@ TEST(Float4Test, InitialisationAndReadAccessWorks) {
 	}
 }
 
-TEST(Float4Test, Assignment) {
-	auto f4 = Float4();
-	auto zeroOneTwoThree = Float4({ 0.0f, 1.0f, 2.0f, 3.0f });
+TYPED_TEST(Float4Test, Assignment) {
+	auto f4 = TypeParam();
+	auto zeroOneTwoThree = TypeParam({ 0.0f, 1.0f, 2.0f, 3.0f });
 	f4 = zeroOneTwoThree;
 
 	const auto xyzw = f4.xyzw();
@@ -41,9 +55,9 @@ TEST(Float4Test, Assignment) {
 	EXPECT_FLOAT_EQ(xyzw[3], 3.0f);
 }
 
-TEST(Float4Test, Float4IsAdditive) {
-	const auto lhs = Float4({ 0.0f, 1.0f, 2.0f, 3.0f });
-	const auto rhs = Float4({ 1.0f, 2.0f, 3.0f, 4.0f });
+TYPED_TEST(Float4Test, Float4IsAdditive) {
+	const auto lhs = TypeParam({ 0.0f, 1.0f, 2.0f, 3.0f });
+	const auto rhs = TypeParam({ 1.0f, 2.0f, 3.0f, 4.0f });
 
 	const auto sum = lhs + rhs;
 	const auto sumXyzw = sum.xyzw();
@@ -76,9 +90,9 @@ TEST(Float4Test, Float4IsAdditive) {
 	EXPECT_FLOAT_EQ(diffEqXyzw[3], -1.0f);
 }
 
-TEST(Float4Test, Float4IsMultiplicative) {
-	const auto lhs = Float4({ 0.0f, 1.0f, 2.0f, 3.0f });
-	const auto rhs = Float4({ 1.0f, 2.0f, 3.0f, 4.0f });
+TYPED_TEST(Float4Test, Float4IsMultiplicative) {
+	const auto lhs = TypeParam({ 0.0f, 1.0f, 2.0f, 3.0f });
+	const auto rhs = TypeParam({ 1.0f, 2.0f, 3.0f, 4.0f });
 
 	const auto product = lhs * rhs;
 	const auto productXyzw = product.xyzw();
@@ -111,4 +125,370 @@ TEST(Float4Test, Float4IsMultiplicative) {
 	EXPECT_FLOAT_EQ(quotientEqXyzw[3], 3.0f / 4.0f);
 }
 
+TYPED_TEST(Float4Test, ShuffleReordersLanes) {
+	const auto f4 = TypeParam({ 0.0f, 1.0f, 2.0f, 3.0f });
+
+	const auto reversedXyzw = f4.template shuffle<3, 2, 1, 0>().xyzw();
+	EXPECT_FLOAT_EQ(reversedXyzw[0], 3.0f);
+	EXPECT_FLOAT_EQ(reversedXyzw[1], 2.0f);
+	EXPECT_FLOAT_EQ(reversedXyzw[2], 1.0f);
+	EXPECT_FLOAT_EQ(reversedXyzw[3], 0.0f);
+
+	const auto mixedXyzw = f4.template shuffle<1, 1, 3, 0>().xyzw();
+	EXPECT_FLOAT_EQ(mixedXyzw[0], 1.0f);
+	EXPECT_FLOAT_EQ(mixedXyzw[1], 1.0f);
+	EXPECT_FLOAT_EQ(mixedXyzw[2], 3.0f);
+	EXPECT_FLOAT_EQ(mixedXyzw[3], 0.0f);
+}
+
+TYPED_TEST(Float4Test, TwoRegisterShuffleTakesLowLanesFromFirstAndHighLanesFromSecond) {
+	const auto low = TypeParam({ 0.0f, 1.0f, 2.0f, 3.0f });
+	const auto high = TypeParam({ 4.0f, 5.0f, 6.0f, 7.0f });
+
+	const auto shuffledXyzw = shuffle<3, 0, 2, 1>(low, high).xyzw();
+	EXPECT_FLOAT_EQ(shuffledXyzw[0], 3.0f);
+	EXPECT_FLOAT_EQ(shuffledXyzw[1], 0.0f);
+	EXPECT_FLOAT_EQ(shuffledXyzw[2], 6.0f);
+	EXPECT_FLOAT_EQ(shuffledXyzw[3], 5.0f);
+}
+
+TYPED_TEST(Float4Test, TransposeSwapsRowsAndColumns) {
+	auto c0 = TypeParam({ 0.0f, 1.0f, 2.0f, 3.0f });
+	auto c1 = TypeParam({ 4.0f, 5.0f, 6.0f, 7.0f });
+	auto c2 = TypeParam({ 8.0f, 9.0f, 10.0f, 11.0f });
+	auto c3 = TypeParam({ 12.0f, 13.0f, 14.0f, 15.0f });
+
+	transpose(c0, c1, c2, c3);
+
+	const TypeParam columns[] = { c0, c1, c2, c3 };
+	for (auto column = 0u; column < 4u; ++column) {
+		const auto xyzw = columns[column].xyzw();
+		for (auto row = 0u; row < 4u; ++row) {
+			EXPECT_FLOAT_EQ(xyzw[row], static_cast<float>(row * 4 + column));
+		}
+	}
+}
+
+TYPED_TEST(Float4Test, BroadcastLaneReplicatesLane) {
+	const auto f4 = TypeParam({ 0.0f, 1.0f, 2.0f, 3.0f });
+
+	const auto broadcastXyzw = f4.template broadcastLane<2>().xyzw();
+	EXPECT_FLOAT_EQ(broadcastXyzw[0], 2.0f);
+	EXPECT_FLOAT_EQ(broadcastXyzw[1], 2.0f);
+	EXPECT_FLOAT_EQ(broadcastXyzw[2], 2.0f);
+	EXPECT_FLOAT_EQ(broadcastXyzw[3], 2.0f);
+}
+
+TYPED_TEST(Float4Test, ExtractLaneReturnsLane) {
+	const auto f4 = TypeParam({ 0.0f, 1.0f, 2.0f, 3.0f });
+
+	EXPECT_FLOAT_EQ(f4.template extractLane<0>(), 0.0f);
+	EXPECT_FLOAT_EQ(f4.template extractLane<1>(), 1.0f);
+	EXPECT_FLOAT_EQ(f4.template extractLane<2>(), 2.0f);
+	EXPECT_FLOAT_EQ(f4.template extractLane<3>(), 3.0f);
+}
+
+TYPED_TEST(Float4Test, InsertLaneReplacesOnlyThatLane) {
+	const auto f4 = TypeParam({ 0.0f, 1.0f, 2.0f, 3.0f });
+
+	const auto x = f4.template insertLane<0>(42.0f).xyzw();
+	const auto y = f4.template insertLane<1>(42.0f).xyzw();
+	const auto z = f4.template insertLane<2>(42.0f).xyzw();
+	const auto w = f4.template insertLane<3>(42.0f).xyzw();
+
+	const std::array<float, 4> inserted[] = { x, y, z, w };
+	for (auto insertedLane = 0u; insertedLane < 4u; ++insertedLane) {
+		for (auto lane = 0u; lane < 4u; ++lane) {
+			const auto expected = (lane == insertedLane) ? 42.0f : static_cast<float>(lane);
+			EXPECT_FLOAT_EQ(inserted[insertedLane][lane], expected);
+		}
+	}
+}
+
+TYPED_TEST(Float4Test, MaddMultipliesAndAdds) {
+	const auto lhs = TypeParam({ 0.0f, 1.0f, 2.0f, 3.0f });
+	const auto rhs = TypeParam({ 1.0f, 2.0f, 3.0f, 4.0f });
+	const auto addend = TypeParam({ 0.5f, -0.5f, 1.0f, -1.0f });
+
+	const auto resultXyzw = madd(lhs, rhs, addend).xyzw();
+	EXPECT_FLOAT_EQ(resultXyzw[0], 0.5f);
+	EXPECT_FLOAT_EQ(resultXyzw[1], 1.5f);
+	EXPECT_FLOAT_EQ(resultXyzw[2], 7.0f);
+	EXPECT_FLOAT_EQ(resultXyzw[3], 11.0f);
+}
+
+TYPED_TEST(Float4Test, MinMaxAndAbsWorkLaneWise) {
+	const auto lhs = TypeParam({ -3.0f, 1.0f, 2.0f, -0.5f });
+	const auto rhs = TypeParam({ 1.0f, -2.0f, 3.0f, -4.0f });
+
+	const auto minXyzw = min(lhs, rhs).xyzw();
+	EXPECT_FLOAT_EQ(minXyzw[0], -3.0f);
+	EXPECT_FLOAT_EQ(minXyzw[1], -2.0f);
+	EXPECT_FLOAT_EQ(minXyzw[2], 2.0f);
+	EXPECT_FLOAT_EQ(minXyzw[3], -4.0f);
+
+	const auto maxXyzw = max(lhs, rhs).xyzw();
+	EXPECT_FLOAT_EQ(maxXyzw[0], 1.0f);
+	EXPECT_FLOAT_EQ(maxXyzw[1], 1.0f);
+	EXPECT_FLOAT_EQ(maxXyzw[2], 3.0f);
+	EXPECT_FLOAT_EQ(maxXyzw[3], -0.5f);
+
+	const auto absXyzw = abs(lhs).xyzw();
+	EXPECT_FLOAT_EQ(absXyzw[0], 3.0f);
+	EXPECT_FLOAT_EQ(absXyzw[1], 1.0f);
+	EXPECT_FLOAT_EQ(absXyzw[2], 2.0f);
+	EXPECT_FLOAT_EQ(absXyzw[3], 0.5f);
+}
+
+TYPED_TEST(Float4Test, SqrtAndReciprocalsAreExact) {
+	const auto f4 = TypeParam({ 1.0f, 4.0f, 16.0f, 0.25f });
+
+	const auto sqrtXyzw = sqrt(f4).xyzw();
+	EXPECT_FLOAT_EQ(sqrtXyzw[0], 1.0f);
+	EXPECT_FLOAT_EQ(sqrtXyzw[1], 2.0f);
+	EXPECT_FLOAT_EQ(sqrtXyzw[2], 4.0f);
+	EXPECT_FLOAT_EQ(sqrtXyzw[3], 0.5f);
+
+	const auto rcpXyzw = rcp(f4).xyzw();
+	EXPECT_FLOAT_EQ(rcpXyzw[0], 1.0f);
+	EXPECT_FLOAT_EQ(rcpXyzw[1], 0.25f);
+	EXPECT_FLOAT_EQ(rcpXyzw[2], 0.0625f);
+	EXPECT_FLOAT_EQ(rcpXyzw[3], 4.0f);
+
+	const auto rsqrtXyzw = rsqrt(f4).xyzw();
+	EXPECT_FLOAT_EQ(rsqrtXyzw[0], 1.0f);
+	EXPECT_FLOAT_EQ(rsqrtXyzw[1], 0.5f);
+	EXPECT_FLOAT_EQ(rsqrtXyzw[2], 0.25f);
+	EXPECT_FLOAT_EQ(rsqrtXyzw[3], 2.0f);
+}
+
+TYPED_TEST(Float4Test, FastReciprocalsApproximateExactOnesAndRefinementImprovesThem) {
+	const auto xyzw = std::array<float, 4>{ 0.3f, 7.0f, 123.456f, 1000.0f };
+	const auto f4 = TypeParam(xyzw);
+
+	const auto rcpXyzw = rcpFast(f4).xyzw();
+	const auto refinedRcpXyzw = rcpFast<1>(f4).xyzw();
+	const auto rsqrtXyzw = rsqrtFast(f4).xyzw();
+	const auto refinedRsqrtXyzw = rsqrtFast<1>(f4).xyzw();
+
+	for (auto lane = 0u; lane < 4u; ++lane) {
+		const auto expectedRcp = 1.0f / xyzw[lane];
+		const auto expectedRsqrt = 1.0f / std::sqrt(xyzw[lane]);
+		EXPECT_NEAR(rcpXyzw[lane], expectedRcp, expectedRcp * 0.0004f);
+		EXPECT_NEAR(refinedRcpXyzw[lane], expectedRcp, expectedRcp * 0.000001f);
+		EXPECT_NEAR(rsqrtXyzw[lane], expectedRsqrt, expectedRsqrt * 0.0004f);
+		EXPECT_NEAR(refinedRsqrtXyzw[lane], expectedRsqrt, expectedRsqrt * 0.000001f);
+	}
+}
+
+TYPED_TEST(Float4Test, HorizontalOperationsReplicateResultAcrossLanes) {
+	const auto f4 = TypeParam({ 2.0f, -1.0f, 5.0f, 3.0f });
+
+	const auto sumXyzw = horizontalAdd(f4).xyzw();
+	const auto minXyzw = horizontalMin(f4).xyzw();
+	const auto maxXyzw = horizontalMax(f4).xyzw();
+	const auto dotXyzw = dot(f4, TypeParam({ 1.0f, 2.0f, 3.0f, 4.0f })).xyzw();
+
+	for (auto lane = 0u; lane < 4u; ++lane) {
+		EXPECT_FLOAT_EQ(sumXyzw[lane], 9.0f);
+		EXPECT_FLOAT_EQ(minXyzw[lane], -1.0f);
+		EXPECT_FLOAT_EQ(maxXyzw[lane], 5.0f);
+		EXPECT_FLOAT_EQ(dotXyzw[lane], 27.0f);
+	}
+}
+
+TYPED_TEST(Float4Test, ComparisonsYieldLaneMasks) {
+	const auto lhs = TypeParam({ 0.0f, 1.0f, 2.0f, 3.0f });
+	const auto rhs = TypeParam({ 1.0f, 1.0f, 1.0f, 1.0f });
+
+	EXPECT_EQ(movemask(cmpLt(lhs, rhs)), 0x1);
+	EXPECT_EQ(movemask(cmpLe(lhs, rhs)), 0x3);
+	EXPECT_EQ(movemask(cmpEq(lhs, rhs)), 0x2);
+	EXPECT_EQ(movemask(cmpLt(rhs, lhs)), 0xc);
+}
+
+TYPED_TEST(Float4Test, MasksCombineAndReduce) {
+	const auto lhs = TypeParam({ 0.0f, 1.0f, 2.0f, 3.0f });
+	const auto rhs = TypeParam({ 1.0f, 1.0f, 1.0f, 1.0f });
+
+	EXPECT_EQ(movemask(cmpLe(lhs, rhs) & cmpLe(rhs, lhs)), 0x2);
+	EXPECT_EQ(movemask(cmpLt(lhs, rhs) | cmpLt(rhs, lhs)), 0xd);
+
+	EXPECT_TRUE(all(cmpLe(lhs, lhs)));
+	EXPECT_FALSE(all(cmpLe(lhs, rhs)));
+	EXPECT_TRUE(any(cmpLe(lhs, rhs)));
+	EXPECT_FALSE(any(cmpLt(lhs, lhs)));
+}
+
+TYPED_TEST(Float4Test, SelectPicksLanesByMask) {
+	const auto lhs = TypeParam({ 0.0f, 1.0f, 2.0f, 3.0f });
+	const auto rhs = TypeParam({ 3.0f, 2.0f, 1.0f, 0.0f });
+
+	const auto selectedXyzw = select(cmpLt(lhs, rhs), lhs, rhs).xyzw();
+	EXPECT_FLOAT_EQ(selectedXyzw[0], 0.0f);
+	EXPECT_FLOAT_EQ(selectedXyzw[1], 1.0f);
+	EXPECT_FLOAT_EQ(selectedXyzw[2], 1.0f);
+	EXPECT_FLOAT_EQ(selectedXyzw[3], 0.0f);
+}
+
+TYPED_TEST(Float4Test, UnalignedLoadAndStoreWorkAtAnyOffset) {
+	alignas(16) float buffer[9] = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f };
+
+	for (auto offset = 0u; offset < 4u; ++offset) {
+		const auto f4 = TypeParam::loadUnaligned(buffer + offset);
+		EXPECT_FLOAT_EQ(f4.template extractLane<0>(), static_cast<float>(offset));
+		EXPECT_FLOAT_EQ(f4.template extractLane<3>(), static_cast<float>(offset + 3));
+
+		float stored[5] = {};
+		f4.storeUnaligned(stored + 1);
+		EXPECT_FLOAT_EQ(stored[0], 0.0f);
+		EXPECT_FLOAT_EQ(stored[1], static_cast<float>(offset));
+		EXPECT_FLOAT_EQ(stored[4], static_cast<float>(offset + 3));
+	}
+}
+
+TYPED_TEST(Float4Test, AlignedAndStreamingStoresRoundTrip) {
+	static_assert(TypeParam::ALIGNMENT >= 16);
+	static_assert(alignof(TypeParam) >= TypeParam::ALIGNMENT);
+
+	alignas(TypeParam::ALIGNMENT) const float source[4] = { 0.0f, 1.0f, 2.0f, 3.0f };
+	const auto f4 = TypeParam::loadAligned(source);
+
+	alignas(TypeParam::ALIGNMENT) float stored[4] = {};
+	f4.storeAligned(stored);
+	EXPECT_FLOAT_EQ(stored[0], 0.0f);
+	EXPECT_FLOAT_EQ(stored[3], 3.0f);
+
+	alignas(TypeParam::ALIGNMENT) float streamed[4] = {};
+	f4.streamStore(streamed);
+	streamFence<typename TypeParam::Implementation>();
+	EXPECT_FLOAT_EQ(streamed[0], 0.0f);
+	EXPECT_FLOAT_EQ(streamed[3], 3.0f);
+}
+
+// --- validation of the native implementation against the reference implementation
+
+class Float4ValidationTest : public testing::Test {
+public:
+
+	Float4ValidationTest() {
+		auto generator = std::mt19937(42);
+		auto distribution = std::uniform_real_distribution<float>(-1000.0f, 1000.0f);
+		for (auto& value : inputs_) {
+			value = distribution(generator);
+		}
+	}
+
+	template <class Operation>
+	std::uint32_t maxUlpDistance(Operation operation) const {
+		auto result = std::uint32_t(0);
+
+		for (auto i = 0u; i + 8u <= inputs_.size(); i += 8u) {
+			const auto lhsXyzw = std::array<float, 4>{ inputs_[i + 0], inputs_[i + 1], inputs_[i + 2], inputs_[i + 3] };
+			const auto rhsXyzw = std::array<float, 4>{ inputs_[i + 4], inputs_[i + 5], inputs_[i + 6], inputs_[i + 7] };
+
+			const auto native = operation(Float4(lhsXyzw), Float4(rhsXyzw)).xyzw();
+			const auto reference = operation(ReferenceFloat4(lhsXyzw), ReferenceFloat4(rhsXyzw)).xyzw();
+
+			for (auto lane = 0u; lane < 4u; ++lane) {
+				result = std::max(result, ulpDistance(native[lane], reference[lane]));
+			}
+		}
+
+		return result;
+	}
+
+private:
+
+	std::vector<float> inputs_ = std::vector<float>(1024);
+
+};
+
+TEST_F(Float4ValidationTest, NativeArithmeticMatchesReferenceBitForBit) {
+	const auto sumUlps = maxUlpDistance([](auto lhs, auto rhs) { return lhs + rhs; });
+	const auto differenceUlps = maxUlpDistance([](auto lhs, auto rhs) { return lhs - rhs; });
+	const auto productUlps = maxUlpDistance([](auto lhs, auto rhs) { return lhs * rhs; });
+	const auto quotientUlps = maxUlpDistance([](auto lhs, auto rhs) { return lhs / rhs; });
+
+	EXPECT_EQ(sumUlps, 0u);
+	EXPECT_EQ(differenceUlps, 0u);
+	EXPECT_EQ(productUlps, 0u);
+	EXPECT_EQ(quotientUlps, 0u);
+}
+
+TEST_F(Float4ValidationTest, NativeAssignmentArithmeticMatchesReferenceBitForBit) {
+	const auto sumUlps = maxUlpDistance([](auto lhs, auto rhs) { return lhs += rhs; });
+	const auto differenceUlps = maxUlpDistance([](auto lhs, auto rhs) { return lhs -= rhs; });
+	const auto productUlps = maxUlpDistance([](auto lhs, auto rhs) { return lhs *= rhs; });
+	const auto quotientUlps = maxUlpDistance([](auto lhs, auto rhs) { return lhs /= rhs; });
+
+	EXPECT_EQ(sumUlps, 0u);
+	EXPECT_EQ(differenceUlps, 0u);
+	EXPECT_EQ(productUlps, 0u);
+	EXPECT_EQ(quotientUlps, 0u);
+}
+
+TEST_F(Float4ValidationTest, NativeLaneOperationsMatchReferenceBitForBit) {
+	const auto shuffleUlps = maxUlpDistance([](auto lhs, auto rhs) {
+			return lhs.template shuffle<2, 0, 3, 1>() + rhs.template shuffle<3, 3, 0, 1>();
+		});
+	const auto broadcastUlps = maxUlpDistance([](auto lhs, auto rhs) {
+			return lhs.template broadcastLane<1>() * rhs.template broadcastLane<3>();
+		});
+	const auto extractUlps = maxUlpDistance([](auto lhs, auto rhs) {
+			return decltype(lhs)({
+				lhs.template extractLane<0>(),
+				lhs.template extractLane<3>(),
+				rhs.template extractLane<1>(),
+				rhs.template extractLane<2>()
+				});
+		});
+
+	EXPECT_EQ(shuffleUlps, 0u);
+	EXPECT_EQ(broadcastUlps, 0u);
+	EXPECT_EQ(extractUlps, 0u);
+}
+
+TEST_F(Float4ValidationTest, NativeMathMatchesReferenceBitForBit) {
+	const auto maddUlps = maxUlpDistance([](auto lhs, auto rhs) { return madd(lhs, rhs, lhs); });
+	const auto minUlps = maxUlpDistance([](auto lhs, auto rhs) { return min(lhs, rhs); });
+	const auto maxUlps = maxUlpDistance([](auto lhs, auto rhs) { return max(lhs, rhs); });
+	const auto absUlps = maxUlpDistance([](auto lhs, auto rhs) { return abs(lhs - rhs); });
+	const auto sqrtUlps = maxUlpDistance([](auto lhs, auto rhs) { return sqrt(abs(lhs + rhs)); });
+	const auto rcpUlps = maxUlpDistance([](auto lhs, auto) { return rcp(lhs); });
+	const auto rsqrtUlps = maxUlpDistance([](auto lhs, auto) { return rsqrt(abs(lhs)); });
+
+	EXPECT_EQ(maddUlps, 0u);
+	EXPECT_EQ(minUlps, 0u);
+	EXPECT_EQ(maxUlps, 0u);
+	EXPECT_EQ(absUlps, 0u);
+	EXPECT_EQ(sqrtUlps, 0u);
+	EXPECT_EQ(rcpUlps, 0u);
+	EXPECT_EQ(rsqrtUlps, 0u);
+}
+
+TEST_F(Float4ValidationTest, NativeHorizontalOperationsMatchReferenceBitForBit) {
+	const auto sumUlps = maxUlpDistance([](auto lhs, auto) { return horizontalAdd(lhs); });
+	const auto minUlps = maxUlpDistance([](auto lhs, auto) { return horizontalMin(lhs); });
+	const auto maxUlps = maxUlpDistance([](auto lhs, auto) { return horizontalMax(lhs); });
+	const auto dotUlps = maxUlpDistance([](auto lhs, auto rhs) { return dot(lhs, rhs); });
+
+	EXPECT_EQ(sumUlps, 0u);
+	EXPECT_EQ(minUlps, 0u);
+	EXPECT_EQ(maxUlps, 0u);
+	EXPECT_EQ(dotUlps, 0u);
+}
+
+TEST_F(Float4ValidationTest, NativeMasksMatchReference) {
+	const auto selectUlps = maxUlpDistance([](auto lhs, auto rhs) {
+			return select(cmpLt(lhs, rhs) | cmpEq(lhs, rhs.template shuffle<1, 0, 3, 2>()), lhs, rhs);
+		});
+	const auto movemaskUlps = maxUlpDistance([](auto lhs, auto rhs) {
+			return decltype(lhs)(static_cast<float>(movemask(cmpLe(lhs, rhs) & cmpLt(rhs, lhs + lhs))));
+		});
+
+	EXPECT_EQ(selectUlps, 0u);
+	EXPECT_EQ(movemaskUlps, 0u);
+}
+
 } // anonymous namespace
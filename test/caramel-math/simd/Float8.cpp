@@ -0,0 +1,169 @@
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "caramel-math/simd/Float8.hpp"
+#include "caramel-math/scalar/ulp-distance.hpp"
+
+using namespace caramel_math::simd;
+using namespace caramel_math::scalar;
+
+namespace /* anonymous */ {
+
+template <class Float8Type>
+class Float8Test : public testing::Test {
+};
+
+using Float8Types = testing::Types<Float8, ReferenceFloat8>;
+
+TYPED_TEST_CASE(Float8Test, Float8Types);
+
+TYPED_TEST(Float8Test, InitialisationAndReadAccessWorks) {
+	{
+		const auto values = TypeParam({ 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f }).values();
+
+		for (auto lane = 0u; lane < 8u; ++lane) {
+			EXPECT_FLOAT_EQ(values[lane], static_cast<float>(lane));
+		}
+	}
+
+	{
+		const auto values = TypeParam(42.0f).values();
+
+		for (auto lane = 0u; lane < 8u; ++lane) {
+			EXPECT_FLOAT_EQ(values[lane], 42.0f);
+		}
+	}
+}
+
+TYPED_TEST(Float8Test, ArithmeticWorksLaneWise) {
+	const auto lhs = TypeParam({ 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f });
+	const auto rhs = TypeParam(2.0f);
+
+	const auto sum = (lhs + rhs).values();
+	const auto difference = (lhs - rhs).values();
+	const auto product = (lhs * rhs).values();
+	const auto quotient = (lhs / rhs).values();
+	const auto multipliedAdded = madd(lhs, rhs, rhs).values();
+
+	for (auto lane = 0u; lane < 8u; ++lane) {
+		const auto value = static_cast<float>(lane);
+		EXPECT_FLOAT_EQ(sum[lane], value + 2.0f);
+		EXPECT_FLOAT_EQ(difference[lane], value - 2.0f);
+		EXPECT_FLOAT_EQ(product[lane], value * 2.0f);
+		EXPECT_FLOAT_EQ(quotient[lane], value / 2.0f);
+		EXPECT_FLOAT_EQ(multipliedAdded[lane], value * 2.0f + 2.0f);
+	}
+}
+
+TYPED_TEST(Float8Test, HalvesAreAccessibleAsFloat4s) {
+	using Half = typename TypeParam::Half;
+
+	const auto f8 = TypeParam::fromHalves(Half({ 0.0f, 1.0f, 2.0f, 3.0f }), Half({ 4.0f, 5.0f, 6.0f, 7.0f }));
+
+	const auto low = f8.lowHalf().xyzw();
+	const auto high = f8.highHalf().xyzw();
+	for (auto lane = 0u; lane < 4u; ++lane) {
+		EXPECT_FLOAT_EQ(low[lane], static_cast<float>(lane));
+		EXPECT_FLOAT_EQ(high[lane], static_cast<float>(lane + 4));
+	}
+
+	EXPECT_FLOAT_EQ(f8.template extractLane<2>(), 2.0f);
+	EXPECT_FLOAT_EQ(f8.template extractLane<5>(), 5.0f);
+}
+
+TYPED_TEST(Float8Test, ShuffleAndBroadcastApplyToEachHalf) {
+	const auto f8 = TypeParam({ 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f });
+
+	const auto shuffled = f8.template shuffle<3, 2, 1, 0>().values();
+	EXPECT_FLOAT_EQ(shuffled[0], 3.0f);
+	EXPECT_FLOAT_EQ(shuffled[3], 0.0f);
+	EXPECT_FLOAT_EQ(shuffled[4], 7.0f);
+	EXPECT_FLOAT_EQ(shuffled[7], 4.0f);
+
+	const auto broadcast = f8.template broadcastLane<1>().values();
+	for (auto lane = 0u; lane < 4u; ++lane) {
+		EXPECT_FLOAT_EQ(broadcast[lane], 1.0f);
+		EXPECT_FLOAT_EQ(broadcast[lane + 4], 5.0f);
+	}
+}
+
+TYPED_TEST(Float8Test, HorizontalOperationsCoverAllLanes) {
+	const auto f8 = TypeParam({ 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, -7.0f });
+
+	EXPECT_FLOAT_EQ(horizontalAdd(f8).template extractLane<6>(), 14.0f);
+	EXPECT_FLOAT_EQ(horizontalMin(f8).template extractLane<0>(), -7.0f);
+	EXPECT_FLOAT_EQ(horizontalMax(f8).template extractLane<7>(), 6.0f);
+	EXPECT_FLOAT_EQ(dot(f8, TypeParam(1.0f)).template extractLane<3>(), 14.0f);
+}
+
+TYPED_TEST(Float8Test, ComparisonsYieldEightLaneMasks) {
+	const auto lhs = TypeParam({ 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f });
+	const auto rhs = TypeParam(4.0f);
+
+	EXPECT_EQ(movemask(cmpLt(lhs, rhs)), 0x0f);
+	EXPECT_EQ(movemask(cmpLe(lhs, rhs)), 0x1f);
+	EXPECT_EQ(movemask(cmpEq(lhs, rhs)), 0x10);
+	EXPECT_TRUE(all(cmpLe(lhs, lhs)));
+	EXPECT_FALSE(any(cmpLt(lhs, lhs)));
+
+	const auto selected = select(cmpLt(lhs, rhs), lhs, rhs).values();
+	EXPECT_FLOAT_EQ(selected[3], 3.0f);
+	EXPECT_FLOAT_EQ(selected[6], 4.0f);
+}
+
+TYPED_TEST(Float8Test, AlignedAndUnalignedLoadsAndStoresRoundTrip) {
+	static_assert(alignof(TypeParam) >= TypeParam::ALIGNMENT);
+
+	alignas(TypeParam::ALIGNMENT) float buffer[12] = {
+		0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f
+		};
+
+	const auto unaligned = TypeParam::loadUnaligned(buffer + 3);
+	EXPECT_FLOAT_EQ(unaligned.template extractLane<0>(), 3.0f);
+	EXPECT_FLOAT_EQ(unaligned.template extractLane<7>(), 10.0f);
+
+	alignas(TypeParam::ALIGNMENT) float stored[8] = {};
+	TypeParam::loadAligned(buffer).storeAligned(stored);
+	EXPECT_FLOAT_EQ(stored[7], 7.0f);
+
+	alignas(TypeParam::ALIGNMENT) float streamed[8] = {};
+	unaligned.streamStore(streamed);
+	streamFence<typename TypeParam::Implementation>();
+	EXPECT_FLOAT_EQ(streamed[0], 3.0f);
+	EXPECT_FLOAT_EQ(streamed[7], 10.0f);
+}
+
+// --- validation of the native implementation against the reference implementation
+
+TEST(Float8ValidationTest, NativeOperationsMatchReferenceBitForBit) {
+	auto generator = std::mt19937(42);
+	auto distribution = std::uniform_real_distribution<float>(-1000.0f, 1000.0f);
+	auto randomValues = [&]() {
+			auto values = std::array<float, 8>();
+			for (auto& value : values) {
+				value = distribution(generator);
+			}
+			return values;
+		};
+
+	auto operation = [](const auto& lhs, const auto& rhs) {
+			const auto combined = madd(lhs.template broadcastLane<2>(), rhs, lhs / rhs);
+			return select(cmpLt(lhs, rhs), sqrt(abs(combined)), max(combined, dot(lhs, rhs)));
+		};
+
+	for (auto iteration = 0; iteration < 128; ++iteration) {
+		const auto lhs = randomValues();
+		const auto rhs = randomValues();
+
+		const auto native = operation(Float8(lhs), Float8(rhs)).values();
+		const auto reference = operation(ReferenceFloat8(lhs), ReferenceFloat8(rhs)).values();
+
+		for (auto lane = 0u; lane < 8u; ++lane) {
+			EXPECT_EQ(ulpDistance(native[lane], reference[lane]), 0u);
+		}
+	}
+}
+
+} // anonymous namespace
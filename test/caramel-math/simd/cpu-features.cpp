@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include "caramel-math/simd/cpu-features.hpp"
+
+using namespace caramel_math::simd;
+
+namespace /* anonymous */ {
+
+TEST(CpuFeaturesTest, InstructionSetNamesRoundTrip) {
+	for (auto instructionSet : {
+		InstructionSet::REFERENCE,
+		InstructionSet::SSE2,
+		InstructionSet::SSE4_1,
+		InstructionSet::AVX2,
+		InstructionSet::AVX512
+		})
+	{
+		EXPECT_EQ(parseInstructionSet(instructionSetName(instructionSet)), instructionSet);
+	}
+
+	EXPECT_FALSE(parseInstructionSet("mmx").has_value());
+}
+
+TEST(CpuFeaturesTest, DetectionIsStable) {
+	EXPECT_EQ(detectInstructionSet(), detectInstructionSet());
+
+#if defined(__AVX2__) && defined(__FMA__)
+	EXPECT_GE(detectInstructionSet(), InstructionSet::AVX2);
+#elif defined(__SSE2__) || defined(_M_X64)
+	EXPECT_GE(detectInstructionSet(), InstructionSet::SSE2);
+#endif
+}
+
+TEST(CpuFeaturesTest, LimitCapsActiveInstructionSet) {
+	limitInstructionSet(InstructionSet::REFERENCE);
+	EXPECT_EQ(activeInstructionSet(), InstructionSet::REFERENCE);
+
+	limitInstructionSet(InstructionSet::AVX512);
+	EXPECT_EQ(activeInstructionSet(), detectInstructionSet());
+}
+
+} // anonymous namespace